@@ -1,8 +1,8 @@
 /**
  * @file AudioManager.cpp
  * @brief Main audio playback coordinator for ESP32 I2S output
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016S
+ * @date 2026-10-16
  * 
  * Implements AudioManager and AudioOutputI2S_Metered classes.
  * Handles I2S initialization, PCM clip playback, and resource management.
@@ -70,6 +70,9 @@ bool AudioOutputI2S_Metered::begin()
 	_cnt = 0;
 	_publishDue = false;
 	setAudioLevelRaw(0);
+	_spectrumHz = hertz;
+	_spectrum.setRate(static_cast<uint32_t>(hertz));
+	setAudioBands(AudioBands{});
 
 	gMeterInstance = this;
 
@@ -81,13 +84,26 @@ bool AudioOutputI2S_Metered::begin()
 	return AudioOutputI2S::begin();
 }
 
-/// Accumulate sample energy for RMS calculation
+/// Follow the decoder's sample rate with the spectrum bins (decoders repeat it every frame)
+bool AudioOutputI2S_Metered::SetRate(int hz)
+{
+	if (hz > 0 && hz != _spectrumHz) {
+		_spectrumHz = hz;
+		_spectrum.setRate(static_cast<uint32_t>(hz));
+	}
+	return AudioOutputI2S::SetRate(hz);
+}
+
+/// Accumulate sample energy for RMS calculation and feed the spectrum bank
 bool AudioOutputI2S_Metered::ConsumeSample(int16_t sample[2])
 {
 	int64_t s = sample[0];
 	_acc += s * s;
 	_cnt++;
 	_publishDue = true;
+	if (_spectrum.addSample(sample[0])) {
+		setAudioBands(_spectrum.bands());
+	}
 	return AudioOutputI2S::ConsumeSample(sample);
 }
 
@@ -146,6 +162,7 @@ void AudioManager::finalizePlayback()
 	releaseSource();
 
 	setAudioLevelRaw(0);
+	setAudioBands(AudioBands{});
 	audioOutput.SetGain(getVolumeShiftedHi() * getVolumeWebMultiplier());
 	setAudioBusy(false);
 	setFragmentPlaying(false);
@@ -1,8 +1,8 @@
 /**
  * @file AudioManager.h
  * @brief Main audio playback coordinator for ESP32 I2S output
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016S
+ * @date 2026-10-16
  * 
  * AudioManager coordinates all audio output: MP3 fragments, TTS sentences,
  * and PCM clips (ping sounds). It owns the I2S hardware and shared decoder
@@ -24,6 +24,7 @@
 #include "AudioGeneratorMP3.h"
 #include "libhelix-mp3/mp3dec.h"
 #include "Globals.h"
+#include "AudioSpectrum.h"
 
 struct AudioFragment;
 
@@ -32,12 +33,14 @@ struct AudioFragment;
  * 
  * Extends AudioOutputI2S to accumulate sample energy for VU meter display.
  * Timer callback cb_audioMeter() triggers periodic level publishing.
+ * Every sample also feeds the spectrum bank, which publishes bands per block.
  */
 class AudioOutputI2S_Metered : public AudioOutputI2S {
 public:
   using AudioOutputI2S::AudioOutputI2S;
 
   bool begin() override;
+  bool SetRate(int hz) override;
   bool ConsumeSample(int16_t sample[2]) override;
 
 protected:
@@ -46,6 +49,8 @@ protected:
   uint64_t  _acc = 0;               ///< Accumulated sample energy (sum of squares)
   uint32_t  _cnt = 0;               ///< Sample count since last publish
   bool      _publishDue = false;    ///< Flag set by timer, cleared after publish
+  AudioSpectrum _spectrum;          ///< Bass/mid/high bands and onsets
+  int       _spectrumHz = 0;        ///< Rate the spectrum bins are tuned for
 };
 
 /**
@@ -0,0 +1,176 @@
+/**
+ * @file AudioSpectrum.cpp
+ * @brief Fixed-point FFT analysis: bass/mid/high bands and onsets
+ * @version 261016S
+ * @date 2026-10-16
+ */
+#include "AudioSpectrum.h"
+
+#include <math.h>
+
+namespace {
+
+enum Band : uint8_t { BAND_BASS, BAND_MID, BAND_HIGH };
+
+constexpr uint8_t kStages = 7;          // log2(FFT_SIZE)
+static_assert((1 << kStages) == AudioSpectrum::FFT_SIZE, "FFT_SIZE must be 2^kStages");
+
+constexpr float kPeakDecay = 0.997f;    // Auto-gain release per block (~3 s half-life)
+constexpr float kPeakFloor = 0.02f;     // Near-silence is not gained up to full scale
+constexpr float kPeakShare = 0.1f;      // A band is gained up to at most 10x below the loudest
+constexpr float kFluxAverage = 0.1f;    // Running mean weight of the newest block
+constexpr float kOnsetRatio = 2.0f;     // Flux over its mean that counts as an onset
+constexpr float kOnsetMin = 0.15f;      // ... and at least this much rise (of the band peaks)
+constexpr float kOnsetSec = 0.15f;      // Onset value decays to 0 in this time
+constexpr float kHoldoffSec = 0.1f;     // No second onset within this time
+
+// Full-scale sine on one bin after windowing (x0.5) and the per-stage halving (/FFT_SIZE)
+constexpr float kBinFullScale = 32767.0f / 4.0f;
+
+uint8_t toByte(float v) {
+  return v >= 1.0f ? 255 : v <= 0.0f ? 0 : static_cast<uint8_t>(v * 255.0f);
+}
+
+uint8_t blocksFor(float sec, float blocksPerSec) {
+  const long n = lroundf(sec * blocksPerSec);
+  return static_cast<uint8_t>(n < 1 ? 1 : n > 255 ? 255 : n);
+}
+
+} // namespace
+
+void AudioSpectrum::setRate(uint32_t hz)
+{
+  if (hz == 0) {
+    return;
+  }
+  const uint32_t decim = hz > ANALYSIS_HZ ? hz / ANALYSIS_HZ : 1;
+  decim_ = static_cast<uint8_t>(decim > 255 ? 255 : decim);
+  const float fs = static_cast<float>(hz) / decim_;
+  const float binHz = fs / FFT_SIZE;
+  bassBin_ = static_cast<uint8_t>(lroundf(BASS_HZ / binHz));
+  highBin_ = static_cast<uint8_t>(lroundf(HIGH_HZ / binHz));
+  if (highBin_ > FFT_SIZE / 2) highBin_ = FFT_SIZE / 2;
+
+  const float turn = 2.0f * static_cast<float>(M_PI) / FFT_SIZE;
+  for (uint16_t n = 0; n < FFT_SIZE; n++) {
+    window_[n] = static_cast<int16_t>(lroundf(16383.5f * (1.0f - cosf(turn * n))));
+  }
+  for (uint16_t n = 0; n < FFT_SIZE / 2; n++) {
+    cos_[n] = static_cast<int16_t>(lroundf(32767.0f * cosf(turn * n)));
+    sin_[n] = static_cast<int16_t>(lroundf(32767.0f * sinf(turn * n)));
+  }
+
+  const float blocksPerSec = fs / FFT_SIZE;
+  holdoffBlocks_ = blocksFor(kHoldoffSec, blocksPerSec);
+  onsetDecay_ = static_cast<uint8_t>(255 / blocksFor(kOnsetSec, blocksPerSec));
+  reset();
+}
+
+void AudioSpectrum::reset()
+{
+  for (float &p : peak_) p = 0.0f;
+  prevAmp_[0] = prevAmp_[1] = 0.0f;
+  fluxMean_ = 0.0f;
+  decimSum_ = 0;
+  decimCount_ = 0;
+  count_ = 0;
+  holdoff_ = 0;
+  out_ = AudioBands{};
+}
+
+bool AudioSpectrum::addSample(int16_t sample)
+{
+  decimSum_ += sample;
+  if (++decimCount_ < decim_) {
+    return false;
+  }
+  block_[count_] = static_cast<int16_t>(((decimSum_ / decim_) * window_[count_]) >> 15);
+  decimSum_ = 0;
+  decimCount_ = 0;
+
+  if (++count_ < FFT_SIZE) {
+    return false;
+  }
+  count_ = 0;
+  finishBlock();
+  return true;
+}
+
+// In-place radix-2 FFT of block_ into re_/im_. Every stage halves, so values
+// stay within 16 bits and each product fits int32.
+void AudioSpectrum::fft()
+{
+  for (uint16_t i = 0; i < FFT_SIZE; i++) {
+    uint16_t r = 0;
+    for (uint8_t b = 0; b < kStages; b++) {
+      r |= ((i >> b) & 1) << (kStages - 1 - b);
+    }
+    re_[r] = block_[i];
+    im_[r] = 0;
+  }
+
+  for (uint16_t half = 1, step = FFT_SIZE / 2; half < FFT_SIZE; half <<= 1, step >>= 1) {
+    for (uint16_t start = 0; start < FFT_SIZE; start += half << 1) {
+      for (uint16_t j = 0; j < half; j++) {
+        const int32_t wr = cos_[j * step];
+        const int32_t wi = -sin_[j * step];
+        const uint16_t a = start + j, b = a + half;
+        const int32_t tr = (re_[b] * wr - im_[b] * wi) >> 15;
+        const int32_t ti = (re_[b] * wi + im_[b] * wr) >> 15;
+        re_[b] = (re_[a] - tr) >> 1;
+        im_[b] = (im_[a] - ti) >> 1;
+        re_[a] = (re_[a] + tr) >> 1;
+        im_[a] = (im_[a] + ti) >> 1;
+      }
+    }
+  }
+}
+
+void AudioSpectrum::finishBlock()
+{
+  fft();
+
+  // Bin 0 (DC) is skipped; bins past FFT_SIZE / 2 mirror the lower half
+  int64_t power[3] = {};
+  for (uint16_t k = 1; k < FFT_SIZE / 2; k++) {
+    const Band band = k <= bassBin_ ? BAND_BASS : k < highBin_ ? BAND_MID : BAND_HIGH;
+    power[band] += static_cast<int64_t>(re_[k]) * re_[k] + static_cast<int64_t>(im_[k]) * im_[k];
+  }
+
+  // Amplitude 1.0 = full-scale sine within the band
+  float amp[3];
+  float loudest = kPeakFloor;
+  for (uint8_t b = 0; b < 3; b++) {
+    amp[b] = sqrtf(static_cast<float>(power[b])) / kBinFullScale;
+    peak_[b] = amp[b] > peak_[b] * kPeakDecay ? amp[b] : peak_[b] * kPeakDecay;
+    loudest = peak_[b] > loudest ? peak_[b] : loudest;
+  }
+  float level[3];
+  for (uint8_t b = 0; b < 3; b++) {
+    const float floor = loudest * kPeakShare;
+    level[b] = amp[b] / (peak_[b] > floor ? peak_[b] : floor);
+  }
+
+  // Flux relative to the band peaks, so the onset threshold follows the auto-gain
+  float flux = 0.0f;
+  for (uint8_t b = BAND_BASS; b <= BAND_MID; b++) {
+    if (amp[b] > prevAmp_[b]) flux += amp[b] - prevAmp_[b];
+    prevAmp_[b] = amp[b];
+  }
+  const float gain = peak_[BAND_BASS] + peak_[BAND_MID];
+  flux /= gain > kPeakFloor ? gain : kPeakFloor;
+
+  uint8_t onset = out_.onset > onsetDecay_ ? out_.onset - onsetDecay_ : 0;
+  if (holdoff_ > 0) {
+    holdoff_--;
+  } else if (flux > kOnsetMin && flux > kOnsetRatio * fluxMean_) {
+    onset = 255;
+    holdoff_ = holdoffBlocks_;
+  }
+  fluxMean_ += (flux - fluxMean_) * kFluxAverage;
+
+  out_.bass = toByte(level[BAND_BASS]);
+  out_.mid = toByte(level[BAND_MID]);
+  out_.high = toByte(level[BAND_HIGH]);
+  out_.onset = onset;
+}
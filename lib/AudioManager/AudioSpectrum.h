@@ -0,0 +1,68 @@
+/**
+ * @file AudioSpectrum.h
+ * @brief Fixed-point FFT analysis: bass/mid/high bands and onsets
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Fed one sample at a time from AudioOutputI2S_Metered::ConsumeSample (decoder
+ * context). The output is box-averaged down to about ANALYSIS_HZ and collected
+ * Hann-windowed into blocks of FFT_SIZE (~15 ms); each block runs one 128-point
+ * integer FFT (int32 butterflies, Q15 twiddles, halved per stage so nothing
+ * overflows), sums bin power into three bands and publishes one AudioBands
+ * snapshot. That is one add per output sample and ~1800 multiplies per block:
+ * well under 1% of a 240 MHz core at 44.1 kHz (tools/host_tests/test_audio_spectrum
+ * reports the host cost per block).
+ *
+ * Bands are auto-gained: each follows its own slowly decaying peak, so quiet
+ * and loud recordings both span 0..255. A band is never gained more than 10x
+ * over the loudest one, so leakage from a strong band stays low. Onsets are
+ * the rise in bass + mid amplitude (spectral flux) against its running mean;
+ * an onset sets the value to 255, which then decays over ~150 ms.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "AudioState.h"
+
+class AudioSpectrum {
+public:
+  static constexpr uint16_t FFT_SIZE = 128;        ///< Decimated samples per analysis block
+  static constexpr uint32_t ANALYSIS_HZ = 8000;    ///< Lowest rate after decimation
+  static constexpr uint16_t BASS_HZ = 250;         ///< Bass: up to here
+  static constexpr uint16_t HIGH_HZ = 2000;        ///< High: from here (mid in between)
+
+  /// Set the output sample rate (recomputes decimation and band edges, resets state)
+  void setRate(uint32_t hz);
+  /// Clear collected samples, gain and onset tracking
+  void reset();
+  /// Add one output sample; true when a block completed and bands() changed
+  bool addSample(int16_t sample);
+  /// Bands of the last completed block
+  AudioBands bands() const { return out_; }
+  /// Output samples per analysis block at the current rate
+  uint32_t samplesPerBlock() const { return static_cast<uint32_t>(decim_) * FFT_SIZE; }
+
+private:
+  void finishBlock();
+  void fft();
+
+  int16_t  window_[FFT_SIZE] = {};     ///< Hann window, Q15
+  int16_t  cos_[FFT_SIZE / 2] = {};    ///< Twiddles, Q15
+  int16_t  sin_[FFT_SIZE / 2] = {};
+  int16_t  block_[FFT_SIZE] = {};      ///< Windowed samples of the block being collected
+  int32_t  re_[FFT_SIZE] = {};         ///< FFT work area
+  int32_t  im_[FFT_SIZE] = {};
+  uint8_t  bassBin_ = 3;               ///< Last bass bin
+  uint8_t  highBin_ = 29;              ///< First high bin
+  float    peak_[3] = {};              ///< Auto-gain peak per band
+  float    prevAmp_[2] = {};           ///< Last block's bass and mid amplitude (onset flux)
+  float    fluxMean_ = 0.0f;
+  int32_t  decimSum_ = 0;
+  uint8_t  decim_ = 1;
+  uint8_t  decimCount_ = 0;
+  uint16_t count_ = 0;
+  uint8_t  holdoff_ = 0;               ///< Blocks until the next onset may fire
+  uint8_t  holdoffBlocks_ = 7;
+  uint8_t  onsetDecay_ = 25;           ///< Onset value drop per block
+  AudioBands out_;
+};
@@ -1,8 +1,8 @@
 /**
  * @file AudioState.cpp
  * @brief Thread-safe audio state storage using atomics
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016Z
+ * @date 2026-10-16
  * 
  * All state is stored in std::atomic variables with relaxed ordering
  * for safe cross-core access on ESP32 dual-core architecture.
@@ -10,6 +10,7 @@
 #include "AudioState.h"
 #include "Globals.h"
 #include "MathUtils.h"
+#include "TimerManager.h"
 
 #include <atomic>
 
@@ -17,6 +18,7 @@ namespace {
 std::atomic<float> g_volumeShiftedHi{0.37f};  // Hi boundary after shifts applied
 std::atomic<float> g_volumeWebMultiplier{1.0f};     // User's web slider multiplier (can be >1.0)
 std::atomic<int16_t> g_audioLevelRaw{0};
+std::atomic<uint32_t> g_audioBands{0};         // AudioBands packed bass | mid << 8 | high << 16 | onset << 24
 std::atomic<bool> g_audioBusy{false};
 std::atomic<uint8_t> g_currentDir{0};
 std::atomic<uint8_t> g_currentFile{0};
@@ -61,6 +63,22 @@ int16_t getAudioLevelRaw() {
     return g_audioLevelRaw.load(std::memory_order_relaxed);
 }
 
+void setAudioBands(const AudioBands& bands) {
+    const uint32_t packed = static_cast<uint32_t>(bands.bass) | (static_cast<uint32_t>(bands.mid) << 8) |
+                            (static_cast<uint32_t>(bands.high) << 16) | (static_cast<uint32_t>(bands.onset) << 24);
+    g_audioBands.store(packed, std::memory_order_relaxed);
+}
+
+AudioBands getAudioBands() {
+    const uint32_t packed = g_audioBands.load(std::memory_order_relaxed);
+    AudioBands bands;
+    bands.bass = static_cast<uint8_t>(packed);
+    bands.mid = static_cast<uint8_t>(packed >> 8);
+    bands.high = static_cast<uint8_t>(packed >> 16);
+    bands.onset = static_cast<uint8_t>(packed >> 24);
+    return bands;
+}
+
 float getVolumeShiftedHi() {
     return g_volumeShiftedHi.load(std::memory_order_relaxed);
 }
@@ -75,6 +93,8 @@ bool isAudioBusy() {
 
 void setAudioBusy(bool value) {
     g_audioBusy.store(value, std::memory_order_relaxed);
+    // loop() pumps the decoder and may not idle from now on; end a sleep begun before the start
+    if (value) timers.wake();
 }
 
 bool getCurrentDirFile(uint8_t& dir, uint8_t& file, uint8_t& score) {
@@ -1,14 +1,14 @@
 /**
  * @file AudioState.h
  * @brief Thread-safe audio state accessors shared between playback modules
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016S
+ * @date 2026-10-16
  * 
  * Provides atomic getters/setters for audio state shared across modules:
  * - Volume levels (shiftedHi, webMultiplier)
  * - Playback status (fragment, sentence, TTS, PCM)
  * - Current track info (dir, file, score)
- * - Audio meter level
+ * - Audio meter level and spectrum bands
  * 
  * All functions use relaxed memory ordering for cross-core ESP32 safety.
  */
@@ -34,6 +34,20 @@ void setAudioLevelRaw(int16_t value);
 /// Get raw audio level for VU meter display
 int16_t getAudioLevelRaw();
 
+/// Spectrum bands of the playing audio, 0..255 each (auto-gained)
+struct AudioBands {
+    uint8_t bass = 0;
+    uint8_t mid = 0;
+    uint8_t high = 0;
+    uint8_t onset = 0;  ///< 255 on a detected onset, decays over ~150 ms
+};
+
+/// Publish spectrum bands (one atomic word: readers never see a mixed block)
+void setAudioBands(const AudioBands& bands);
+
+/// Get the latest spectrum bands
+AudioBands getAudioBands();
+
 /// Get volume Hi boundary after shifts applied
 float getVolumeShiftedHi();
 
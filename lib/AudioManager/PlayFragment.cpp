@@ -1,8 +1,8 @@
 /**
  * @file PlayFragment.cpp
  * @brief MP3 fragment playback with sine-power fade curves
- * @version 260219E
- * @date 2026-02-19
+ * @version 261016F
+ * @date 2026-10-16
  * 
  * Implements fade-in/fade-out using shared Globals::fadeCurve (sine² curve).
  * Timer-driven: no polling, no loop() dependency.
@@ -29,6 +29,11 @@ struct FadeState {
     uint8_t  outIndex = 0;
     uint8_t  lastCurveIndex = 0;
     float    currentFraction = 0.0f;
+    // Handles: cancel/re-create per fragment without (cb, token) lookups
+    TimerHandle fadeInTimer;
+    TimerHandle fadeOutTimer;
+    TimerHandle beginFadeOutTimer;
+    TimerHandle readyTimer;
 };
 
 FadeState& fade() {
@@ -59,6 +64,13 @@ void resetFadeIndices() {
     fade().currentFraction = 0.0f;
 }
 
+void cancelFragmentTimers() {
+    timers.cancel(fade().readyTimer);
+    timers.cancel(fade().beginFadeOutTimer);
+    timers.cancel(fade().fadeInTimer);
+    timers.cancel(fade().fadeOutTimer);
+}
+
 void stopPlayback();
 void cb_fadeIn();
 void cb_fadeOut();
@@ -131,27 +143,28 @@ bool start(const AudioFragment& fragment) {
     setCurrentDirFile(fragment.dirIndex, fragment.fileIndex, fragment.score);
     WebGuiStatus::setFragment(fragment.dirIndex, fragment.fileIndex, fragment.score, fragment.durationMs);
 
-    timers.cancel(cb_beginFadeOut);
-    timers.cancel(cb_fadeIn);
-    timers.cancel(cb_fadeOut);
+    cancelFragmentTimers();
 
-    if (!timers.create(state.stepMs, Globals::fadeStepCount, cb_fadeIn)) {
+    state.fadeInTimer = timers.create(state.stepMs, Globals::fadeStepCount, cb_fadeIn, 1.0f, 1, TimerPriority::REALTIME);
+    if (!state.fadeInTimer) {
         LOG_WARN("[Fade] Failed to start fade-in timer\n");
     }
 
     if (state.fadeOutDelayMs == 0) {
-        if (!timers.create(state.stepMs, Globals::fadeStepCount, cb_fadeOut)) {
+        state.fadeOutTimer = timers.create(state.stepMs, Globals::fadeStepCount, cb_fadeOut, 1.0f, 1, TimerPriority::REALTIME);
+        if (!state.fadeOutTimer) {
             LOG_WARN("[Fade] Failed to start fade-out timer\n");
         }
     } else {
-        if (!timers.create(state.fadeOutDelayMs, 1, cb_beginFadeOut)) {
+        state.beginFadeOutTimer = timers.create(state.fadeOutDelayMs, 1, cb_beginFadeOut);
+        if (!state.beginFadeOutTimer) {
             LOG_WARN("[Fade] Failed to create fade-out delay (%lu ms)\n", static_cast<unsigned long>(state.fadeOutDelayMs));
         }
     }
 
     // Timer-based completion (T4 rule: never use loop() return for completion)
-    timers.cancel(cb_fragmentReady);
-    if (!timers.create(fragment.durationMs, 1, cb_fragmentReady)) {
+    state.readyTimer = timers.create(fragment.durationMs, 1, cb_fragmentReady);
+    if (!state.readyTimer) {
         LOG_WARN("[Audio] Failed to create fragment completion timer\n");
     }
 
@@ -171,10 +184,7 @@ void stop(uint16_t fadeOutMs) {
 
     auto& state = fade();
 
-    timers.cancel(cb_fragmentReady);
-    timers.cancel(cb_beginFadeOut);
-    timers.cancel(cb_fadeOut);
-    timers.cancel(cb_fadeIn);
+    cancelFragmentTimers();
 
     uint16_t effective = fadeOutMs;
     if (effective == kFadeUseCurrent) {
@@ -199,7 +209,8 @@ void stop(uint16_t fadeOutMs) {
     }
     state.outIndex = startOffset;
 
-    if (!timers.create(state.stepMs, Globals::fadeStepCount, cb_fadeOut)) {
+    state.fadeOutTimer = timers.create(state.stepMs, Globals::fadeStepCount, cb_fadeOut, 1.0f, 1, TimerPriority::REALTIME);
+    if (!state.fadeOutTimer) {
         LOG_WARN("[Fade] Failed to create stop() fade-out timer\n");
         stopPlayback();
     }
@@ -215,10 +226,7 @@ void updateVolume() {
 namespace {
 
 void stopPlayback() {
-    timers.cancel(cb_fragmentReady);
-    timers.cancel(cb_beginFadeOut);
-    timers.cancel(cb_fadeIn);
-    timers.cancel(cb_fadeOut);
+    cancelFragmentTimers();
 
     if (audio.audioMp3Decoder) {
         audio.audioMp3Decoder->stop();
@@ -261,7 +269,7 @@ void cb_fadeIn() {
 
     state.inIndex++;
     if (state.inIndex >= Globals::fadeStepCount) {
-        timers.cancel(cb_fadeIn);
+        timers.cancel(state.fadeInTimer);
         state.inIndex = 0;
     }
 }
@@ -278,7 +286,7 @@ void cb_fadeOut() {
 
     state.outIndex++;
     if (state.outIndex >= Globals::fadeStepCount) {
-        timers.cancel(cb_fadeOut);
+        timers.cancel(state.fadeOutTimer);
         state.outIndex = 0;
         stopPlayback();
     }
@@ -291,12 +299,13 @@ void cb_beginFadeOut() {
         startOffset = static_cast<uint8_t>((Globals::fadeStepCount - 1U) - state.lastCurveIndex);
     }
     state.outIndex = startOffset;
-    timers.cancel(cb_fadeOut);
+    timers.cancel(state.fadeOutTimer);
     uint16_t step = state.stepMs;
     if (step == 0) {
         step = 1;
     }
-    if (!timers.create(step, Globals::fadeStepCount, cb_fadeOut)) {
+    state.fadeOutTimer = timers.create(step, Globals::fadeStepCount, cb_fadeOut, 1.0f, 1, TimerPriority::REALTIME);
+    if (!state.fadeOutTimer) {
         LOG_WARN("[Fade] Failed to launch delayed fade-out timer\n");
         stopPlayback();
     }
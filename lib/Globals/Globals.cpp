@@ -1,8 +1,8 @@
 /**
  * @file Globals.cpp
  * @brief CSV override loader for Globals
- * @version 260219A
- * @date 2026-02-19
+ * @version 261016Y
+ * @date 2026-10-16
  */
 #include "Arduino.h"
 #include "Globals.h"
@@ -264,6 +264,72 @@ static void applyOverride(const char* key, char type, const char* value) {
             PF_BOOT("[Globals] patternChangeIntervalMs = %lu\n", (unsigned long)u32);
         }
     }
+    else if (strcmp(key, "lightFpsMin") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 >= 1 && u32 <= 255) {
+            Globals::lightFpsMin = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] lightFpsMin = %u\n", Globals::lightFpsMin);
+        }
+    }
+    else if (strcmp(key, "lightFpsMax") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 >= 1 && u32 <= 255) {
+            Globals::lightFpsMax = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] lightFpsMax = %u\n", Globals::lightFpsMax);
+        }
+    }
+    else if (strcmp(key, "lightAudioFps") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 255) {
+            Globals::lightAudioFps = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] lightAudioFps = %u\n", Globals::lightAudioFps);
+        }
+    }
+    else if (strcmp(key, "lightFrameDelta") == 0 && type == 'f') {
+        if (parseFloat(value, &f32) && f32 > 0.0f) {
+            Globals::lightFrameDelta = f32;
+            PF_BOOT("[Globals] lightFrameDelta = %.1f\n", f32);
+        }
+    }
+    else if (strcmp(key, "lightDitherMinFps") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 255) {
+            Globals::lightDitherMinFps = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] lightDitherMinFps = %u\n", Globals::lightDitherMinFps);
+        }
+    }
+    else if (strcmp(key, "lightProgramBudget") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 > 0 && u32 <= 65535) {
+            Globals::lightProgramBudget = static_cast<uint16_t>(u32);
+            PF_BOOT("[Globals] lightProgramBudget = %u\n", Globals::lightProgramBudget);
+        }
+    }
+    else if (strcmp(key, "lightGamma") == 0 && type == 'f') {
+        if (parseFloat(value, &f32) && f32 >= 0.2f && f32 <= 5.0f) {
+            Globals::lightGamma = f32;
+            PF_BOOT("[Globals] lightGamma = %.2f\n", static_cast<double>(f32));
+        }
+    }
+    else if (strcmp(key, "lightWhiteR") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 255) {
+            Globals::lightWhiteR = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] lightWhiteR = %u\n", Globals::lightWhiteR);
+        }
+    }
+    else if (strcmp(key, "lightWhiteG") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 255) {
+            Globals::lightWhiteG = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] lightWhiteG = %u\n", Globals::lightWhiteG);
+        }
+    }
+    else if (strcmp(key, "lightWhiteB") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 255) {
+            Globals::lightWhiteB = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] lightWhiteB = %u\n", Globals::lightWhiteB);
+        }
+    }
+    else if (strcmp(key, "lightMorphMs") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 60000) {
+            Globals::lightMorphMs = static_cast<uint16_t>(u32);
+            PF_BOOT("[Globals] lightMorphMs = %u\n", Globals::lightMorphMs);
+        }
+    }
     else if (strcmp(key, "maxBrightness") == 0 && type == 'u') {
         if (parseUint32(value, &u32) && u32 <= 255) {
             Globals::maxBrightness = static_cast<uint8_t>(u32);
@@ -348,10 +414,10 @@ static void applyOverride(const char* key, char type, const char* value) {
     // ═══════════════════════════════════════════════════════════
     // SENSORS
     // ═══════════════════════════════════════════════════════════
-    else if (strcmp(key, "luxMeasurementDelayMs") == 0 && type == 'u') {
-        if (parseUint32(value, &u32)) {
-            Globals::luxMeasurementDelayMs = u32;
-            PF_BOOT("[Globals] luxMeasurementDelayMs = %lu\n", (unsigned long)u32);
+    else if (strcmp(key, "luxBlankEvery") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 255) {
+            Globals::luxBlankEvery = static_cast<uint8_t>(u32);
+            PF_BOOT("[Globals] luxBlankEvery = %u\n", Globals::luxBlankEvery);
         }
     }
     else if (strcmp(key, "luxMeasurementIntervalMs") == 0 && type == 'u') {
@@ -630,6 +696,21 @@ static void applyOverride(const char* key, char type, const char* value) {
         }
     }
     // ═══════════════════════════════════════════════════════════
+    // LOOP
+    // ═══════════════════════════════════════════════════════════
+    else if (strcmp(key, "loopIdleMaxMs") == 0 && type == 'u') {
+        if (parseUint32(value, &u32) && u32 <= 1000) {
+            Globals::loopIdleMaxMs = static_cast<uint16_t>(u32);
+            PF_BOOT("[Globals] loopIdleMaxMs = %u\n", Globals::loopIdleMaxMs);
+        }
+    }
+    else if (strcmp(key, "timerBackgroundBudgetUs") == 0 && type == 'u') {
+        if (parseUint32(value, &u32)) {
+            Globals::timerBackgroundBudgetUs = u32;
+            PF_BOOT("[Globals] timerBackgroundBudgetUs = %lu\n", (unsigned long)u32);
+        }
+    }
+    // ═══════════════════════════════════════════════════════════
     // DEBUG
     // ═══════════════════════════════════════════════════════════
     else if (strcmp(key, "timerStatusIntervalMs") == 0 && type == 'u') {
@@ -1,8 +1,8 @@
 /**
  * @file Globals.h
  * @brief Global constants, timing intervals, and utility functions
- * @version 260226B
- * @date 2026-02-26
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #pragma once
 
@@ -14,7 +14,7 @@
 #include <type_traits>
 
 // Firmware version code (no device prefix)
-#define FIRMWARE_VERSION_CODE "260227A"
+#define FIRMWARE_VERSION_CODE "261016Z"
 
 // === Compile-time constants (NOT overridable) ===
 #define SECONDS_TICK 1000
@@ -25,12 +25,32 @@
 // Maximum directories in a themebox (theme_boxes.csv entries column)
 #define MAX_THEME_DIRS 500
 
-// Timer pool capacity (TimerManager slot count)
+// Timer pool capacity (TimerManager slot count); host benchmarks build other sizes
+#ifndef MAX_TIMERS
 #define MAX_TIMERS 40
+#endif
 
 // Debug flags
 #define SHOW_TIMER_STATUS LOG_BOOT_SPAM  // Set true to see timer usage in serial
 
+// Timer profiler: per-(cb, token) run time and lateness, served at /api/health/timers
+// Build with -DTIMER_PROFILE=1; when 0 the profiler is compiled out completely
+#ifndef TIMER_PROFILE
+#define TIMER_PROFILE 0
+#endif
+#define MAX_TIMER_PROFILES 48
+
+// LED renderer: 0 = float math, 1 = fixed point per LED (Q16.16 distances, Q16 blend/fade, phase sine tables).
+// Phase oscillators use FastLED sin16 in both, so the two place the ring and center identically.
+#ifndef LIGHT_FIXED_POINT
+#define LIGHT_FIXED_POINT 0
+#endif
+
+// LED output: 0 = render in loop() (repaint timer), 1 = render task on the other core (seqlock handoff)
+#ifndef LIGHT_RENDER_TASK
+#define LIGHT_RENDER_TASK 0
+#endif
+
 // Growing interval cap (TimerManager)
 constexpr uint32_t MAX_GROWTH_INTERVAL_MS = MINUTES(1200);   // cap
 
@@ -77,13 +97,24 @@ struct Globals {
     inline static uint32_t defaultWebExpiryMs     = HOURS(13);    // Web audio settings auto-reset after 13 hours
 
     // ─────────────────────────────────────────────────────────────
-    // LIGHT/PATTERN (5 params)
+    // LIGHT/PATTERN (16 params)
     // ─────────────────────────────────────────────────────────────
     inline static uint16_t lightFallbackIntervalMs = 300U;        // Pattern update interval
     inline static uint32_t shiftCheckIntervalMs    = MINUTES(1);  // Check CSV shifts interval
     inline static float    defaultFadeWidth        = 64.0f;       // LED color fade smoothness
     inline static uint32_t colorChangeIntervalMs   = 20880000UL;  // Random color change (5.8h)
     inline static uint32_t patternChangeIntervalMs  = 17640000UL;  // Random pattern change (4.9h)
+    inline static uint8_t  lightFpsMin             = 5;           // Repaint rate floor (static/slow shows)
+    inline static uint8_t  lightFpsMax             = 60;          // Repaint rate cap (fast motion)
+    inline static uint8_t  lightAudioFps           = 30;          // Min repaint rate while audio modulates brightness
+    inline static float    lightFrameDelta         = 2.0f;        // Brightness steps per LED worth a new frame
+    inline static uint8_t  lightDitherMinFps       = 25;          // Temporal dithering rate, also between slow frames (0=frame rate, 255=off)
+    inline static uint16_t lightProgramBudget      = 8000U;       // Light program instructions per frame (all LEDs)
+    inline static float    lightGamma              = 1.0f;        // LED color gamma (1.0 = uncorrected)
+    inline static uint8_t  lightWhiteR             = 255U;        // White balance: red channel at full scale
+    inline static uint8_t  lightWhiteG             = 255U;        // White balance: green channel at full scale
+    inline static uint8_t  lightWhiteB             = 255U;        // White balance: blue channel at full scale
+    inline static uint16_t lightMorphMs            = 1500U;       // Pattern/color change morph time (0 = jump)
 
     // ─────────────────────────────────────────────────────────────
     // BRIGHTNESS/LUX (10 params)
@@ -102,7 +133,7 @@ struct Globals {
     inline static float    luxGamma                = 0.4f;        // Stevens' power law exponent (0.33-0.5)
     inline static int8_t   calendarShiftLo         = -20;         // Calendar shift minimum
     inline static int8_t   calendarShiftHi         = +20;         // Calendar shift maximum
-    inline static uint16_t maxMilliamps            = 1200U;       // FastLED power limit
+    inline static uint16_t maxMilliamps            = 1200U;       // LED power budget (at MAX_VOLTS, LightController limiter)
 
     // ─────────────────────────────────────────────────────────────
     // SENSORS (16 params)
@@ -112,7 +143,7 @@ struct Globals {
     inline static float    distanceSensorInitGrowth  = 1.5f;      // VL53L1X: interval multiplier per retry (5000 -> 7500 -> 11250...)
     inline static uint16_t luxSensorInitDelayMs      = 1000U;     // VEML7700: first retry delay (ms)
     inline static float    luxSensorInitGrowth       = 1.5f;      // VEML7700: interval multiplier per retry (1000 -> 1500 -> 2250...)
-    inline static uint32_t luxMeasurementDelayMs     = 800UL;     // Delay after lux trigger
+    inline static uint8_t  luxBlankEvery             = 5U;        // Blank the LEDs every Nth lux measurement (0 = only until learned)
     inline static uint32_t luxMeasurementIntervalMs  = MINUTES(2); // Lux polling interval
     inline static uint16_t sensorBaseDefaultMs       = 100U;      // Distance sensor base interval
     inline static uint16_t sensorFastIntervalMs      = 30U;       // Fast interval (motion)
@@ -217,6 +248,12 @@ struct Globals {
     // ─────────────────────────────────────────────────────────────
     inline static uint32_t sdHealthCheckIntervalMs = MINUTES(6);  // Periodic SD presence check
 
+    // ─────────────────────────────────────────────────────────────
+    // LOOP (2 params)
+    // ─────────────────────────────────────────────────────────────
+    inline static uint16_t loopIdleMaxMs           = 100U;         // Max loop() sleep until next timer (0 = never sleep)
+    inline static uint32_t timerBackgroundBudgetUs = 4000UL;       // Per-update() time after which BACKGROUND timers wait
+
     // ─────────────────────────────────────────────────────────────
     // DEBUG (2 params)
     // ─────────────────────────────────────────────────────────────
@@ -225,17 +262,17 @@ struct Globals {
 
     // ─────────────────────────────────────────────────────────────
     // FADE CURVE — shared sine² curve, computed once at boot
-    // Used by audio fade (PlayFragment) and brightness fade (LightRun)
+    // Used by audio fade (PlayFragment)
     // ─────────────────────────────────────────────────────────────
     static constexpr uint8_t fadeStepCount = 15;
     static float fadeCurve[fadeStepCount];
     static void fillFadeCurve();
 
-    // Guards applyBrightness() during lux fade: both the 50ms repaint timer
-    // and the 26ms fade callbacks call FastLED.setBrightness(). Without this
-    // flag the repaint would stomp the fade curve mid-step. Set by LightRun,
-    // read by LightController. Lives in Globals for cross-library visibility.
-    inline static bool brightnessFading = false;
+    // Guards applyBrightness() while a lux measurement blanks the LEDs: the
+    // repaint timer would otherwise restore the brightness mid-integration.
+    // Set by LightRun, read by LightController. Lives in Globals for
+    // cross-library visibility.
+    inline static bool luxBlanking = false;
 
     // Initialize: load CSV overrides (call after SD init)
     static void begin();
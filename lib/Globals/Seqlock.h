@@ -0,0 +1,68 @@
+/**
+ * @file Seqlock.h
+ * @brief Single-writer snapshot handoff between tasks/cores (seqlock)
+ * @version 261016L
+ * @date 2026-10-16
+ *
+ * The writer never blocks; a reader retries while a write is in progress and
+ * always gets the latest complete snapshot. Payload words are relaxed atomics,
+ * so there is no data race in the C++ memory model.
+ * Depends only on the standard library: builds on host and can be exercised
+ * with std::thread.
+ *
+ * Writer and reader must run on different cores (or the writer must not be
+ * preempted by the reader), otherwise a reader could spin on a paused write.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+public:
+    /// Publish a new snapshot (single writer only)
+    void write(const T &value) {
+        uint32_t buf[WORDS] = {};
+        memcpy(buf, &value, sizeof(T));
+
+        const uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);  // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; i++) {
+            words_[i].store(buf[i], std::memory_order_relaxed);
+        }
+        seq_.store(seq + 2, std::memory_order_release);  // Even: snapshot complete
+    }
+
+    /// Copy the latest snapshot; returns its sequence number (0 = nothing written yet)
+    uint32_t read(T &out) const {
+        uint32_t buf[WORDS];
+        for (;;) {
+            const uint32_t seq = seq_.load(std::memory_order_acquire);
+            if (seq & 1U) continue;
+            for (size_t i = 0; i < WORDS; i++) {
+                buf[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == seq) {
+                memcpy(&out, buf, sizeof(T));
+                return seq;
+            }
+        }
+    }
+
+    /// Sequence of the latest complete snapshot (changes on every write)
+    uint32_t sequence() const { return seq_.load(std::memory_order_acquire) & ~1U; }
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> seq_{0};
+    std::atomic<uint32_t> words_[WORDS] = {};
+};
@@ -0,0 +1,301 @@
+/**
+ * @file BakedShow.cpp
+ * @brief Pre-rendered light shows streamed from SD (baked shows)
+ * @version 261016U
+ * @date 2026-10-16
+ */
+#include "BakedShow.h"
+
+#include <Arduino.h>
+#include <atomic>
+#include <string.h>
+#include "Globals.h"
+#include "LEDMap.h"
+#include "SDController.h"
+#include "TimerManager.h"
+
+namespace BakedShow {
+
+namespace {
+
+constexpr uint8_t MAX_CATCHUP = 8;  // Frames decoded per render call when behind
+
+// Loop core: file and ring head
+File file;
+uint32_t fileSize = 0;
+uint32_t filePos = 0;
+uint8_t showId = 0;
+uint8_t refusedId = 0;  // Last id that failed to start: not retried on every PlayLightShow
+Header header = {};
+uint32_t startMs = 0;
+
+uint8_t ring[RING_SIZE];
+std::atomic<uint32_t> ringHead{0};  // Bytes written (loop core)
+std::atomic<uint32_t> ringTail{0};  // Bytes consumed (renderer)
+std::atomic<bool> broken{false};    // Renderer found bad frame data; fill() stops the show
+
+// Renderer: decode state
+uint8_t current[FRAME_BYTES];
+uint8_t payload[PAYLOAD_MAX];
+uint32_t decoded = 0;      // Frames decoded since start()
+uint32_t loopFrame = 0;    // Position within the file (delta chain restarts at the file start)
+
+Stats stat = {};
+
+#if LIGHT_RENDER_TASK
+// start() on the loop core must not touch the renderer's state while a frame is in
+// flight: it raises this, and the renderer resets itself on its next call
+std::atomic<bool> restartPending{false};
+#endif
+
+uint16_t readU16(const uint8_t *p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t readU32(const uint8_t *p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// Renderer side of a restart: drop what is buffered, start from black
+void resetRenderer() {
+    ringTail.store(ringHead.load(std::memory_order_acquire), std::memory_order_release);
+    memset(current, 0, sizeof(current));
+    decoded = 0;
+    loopFrame = 0;
+    stat.frames = 0;
+    stat.underruns = 0;
+    stat.ringLow = RING_SIZE;
+}
+
+void copyFromRing(uint32_t pos, uint8_t *out, size_t len) {
+    const size_t at = pos & (RING_SIZE - 1);
+    const size_t first = len < RING_SIZE - at ? len : RING_SIZE - at;
+    memcpy(out, ring + at, first);
+    memcpy(out + first, ring, len - first);
+}
+
+// Decode the next buffered frame into current[]; false if it is not complete yet
+bool decodeNext() {
+    const uint32_t tail = ringTail.load(std::memory_order_relaxed);
+    const uint32_t available = ringHead.load(std::memory_order_acquire) - tail;
+    if (available < 2) return false;
+    uint8_t lenBytes[2];
+    copyFromRing(tail, lenBytes, 2);
+    const uint16_t len = readU16(lenBytes);
+    if (len > PAYLOAD_MAX) {
+        broken.store(true, std::memory_order_relaxed);
+        return false;
+    }
+    if (available < 2U + len) return false;
+    copyFromRing(tail + 2, payload, len);
+    ringTail.store(tail + 2 + len, std::memory_order_release);
+
+    if (loopFrame == 0) memset(current, 0, sizeof(current));
+    if (!decodeFrame(payload, len, current)) {
+        broken.store(true, std::memory_order_relaxed);
+        return false;
+    }
+    if (++loopFrame >= header.frameCount) loopFrame = 0;
+    decoded++;
+    stat.frames++;
+    return true;
+}
+
+} // namespace
+
+bool parseHeader(const uint8_t *data, size_t size, Header &out) {
+    if (size < HEADER_SIZE || memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+    out.ledCount = readU16(data + 4);
+    out.fps = data[6];
+    out.frameCount = readU32(data + 8);
+    out.mapHash = readU32(data + 12);
+    return true;
+}
+
+uint32_t mapHash(const float *xs, const float *ys, uint16_t count) {
+    uint32_t h = 2166136261UL;
+    auto add = [&h](float v) {
+        uint8_t bytes[sizeof(float)];
+        memcpy(bytes, &v, sizeof(bytes));
+        for (uint8_t b : bytes) {
+            h = (h ^ b) * 16777619UL;
+        }
+    };
+    for (uint16_t i = 0; i < count; i++) {
+        add(xs[i]);
+        add(ys[i]);
+    }
+    return h;
+}
+
+bool decodeFrame(const uint8_t *data, size_t size, uint8_t *frame) {
+    size_t in = 0, out = 0;
+    while (in < size) {
+        const uint8_t token = data[in++];
+        if (token < 0x80) {
+            out += token + 1U;
+            if (out > FRAME_BYTES) return false;
+            continue;
+        }
+        const size_t n = token - 0x7FU;
+        if (out + n > FRAME_BYTES || in + n > size) return false;
+        memcpy(frame + out, data + in, n);
+        in += n;
+        out += n;
+    }
+    return true;
+}
+
+bool start(uint8_t id) {
+    stop();
+    if (id == 0 || id == refusedId) {
+        return false;
+    }
+    refusedId = id;
+    char path[32];
+    snprintf(path, sizeof(path), "/light_shows/%u.lsb", id);
+    if (!SDController::fileExists(path)) {
+        PF("[BakedShow] %s not found\n", path);
+        return false;
+    }
+    File f = SDController::openStream(path);
+    if (!f) {
+        return false;
+    }
+
+    uint8_t data[HEADER_SIZE];
+    Header h;
+    const bool valid = SDController::readStream(f, 0, data, sizeof(data)) == sizeof(data) &&
+                       parseHeader(data, sizeof(data), h) && h.ledCount == NUM_LEDS &&
+                       h.fps > 0 && h.frameCount > 0 && f.size() > HEADER_SIZE;
+    if (!valid) {
+        PF("[BakedShow] %s refused\n", path);
+        SDController::closeStream(f);
+        return false;
+    }
+    if (h.mapHash != 0 && h.mapHash != mapHash(getLEDMapX(), getLEDMapY(), NUM_LEDS)) {
+        PF("[BakedShow] %s was baked for another LED map\n", path);
+        SDController::closeStream(f);
+        return false;
+    }
+
+    file = f;
+    fileSize = f.size();
+    filePos = HEADER_SIZE;
+    header = h;
+    showId = id;
+    refusedId = 0;
+    startMs = timers.now();
+    stat.bytesRead = 0;
+    stat.reads = 0;
+    stat.readUsMax = 0;
+    broken.store(false, std::memory_order_relaxed);
+#if LIGHT_RENDER_TASK
+    restartPending.store(true, std::memory_order_release);
+#else
+    resetRenderer();
+#endif
+    PF("[BakedShow] %s: %u frames at %u fps, %u KB\n", path, static_cast<unsigned>(h.frameCount),
+       h.fps, static_cast<unsigned>(fileSize / 1024));
+    return true;
+}
+
+void stop() {
+    if (!showId) {
+        return;
+    }
+    SDController::closeStream(file);
+    file = File();
+    showId = 0;
+}
+
+uint8_t activeId() {
+    return showId;
+}
+
+uint8_t fps() {
+    return showId ? header.fps : 0;
+}
+
+void fill(bool audioBusy) {
+    if (!showId) {
+        return;
+    }
+    if (broken.load(std::memory_order_relaxed)) {
+        PF("[BakedShow] /light_shows/%u.lsb: bad frame data, stopped\n", showId);
+        stop();
+        return;
+    }
+#if LIGHT_RENDER_TASK
+    if (restartPending.load(std::memory_order_acquire)) return;
+#endif
+
+    // SD share: an MP3 at 128 kbit/s pulls 16 KB/s through AudioFileSourceSD, in its own
+    // reads between repaint ticks. CHUNKS_WITH_AUDIO (2) lets a show read up to 1 KB per
+    // frame (20 KB/s at 20 fps) while a tick adds at most two short reads to the loop.
+    // Without audio the ring is topped up completely.
+    const uint8_t maxChunks = audioBusy ? CHUNKS_WITH_AUDIO : RING_SIZE / CHUNK_SIZE;
+    for (uint8_t n = 0; n < maxChunks; n++) {
+        const uint32_t head = ringHead.load(std::memory_order_relaxed);
+        const uint32_t used = head - ringTail.load(std::memory_order_acquire);
+        const size_t at = head & (RING_SIZE - 1);
+        size_t len = RING_SIZE - at < CHUNK_SIZE ? RING_SIZE - at : CHUNK_SIZE;
+        if (RING_SIZE - used < len) break;
+        if (len > fileSize - filePos) len = fileSize - filePos;
+
+        const uint32_t t0 = micros();
+        const size_t got = SDController::readStream(file, filePos, ring + at, len);
+        const uint32_t us = micros() - t0;
+        if (got == 0) {
+            PF("[BakedShow] /light_shows/%u.lsb: read failed, stopped\n", showId);
+            stop();
+            return;
+        }
+        if (stat.reads == 0) startMs = timers.now();  // Frame 0 is due once its data is in
+        stat.bytesRead += got;
+        stat.reads++;
+        if (us > stat.readUsMax) stat.readUsMax = us;
+
+        filePos += got;
+        if (filePos >= fileSize) filePos = HEADER_SIZE;  // Loop
+        ringHead.store(head + got, std::memory_order_release);
+    }
+}
+
+uint32_t frameIndex() {
+    return static_cast<uint32_t>((static_cast<uint64_t>(timers.now() - startMs) * header.fps) / 1000U);
+}
+
+const uint8_t *advance(uint32_t index) {
+#if LIGHT_RENDER_TASK
+    if (restartPending.load(std::memory_order_acquire)) {
+        resetRenderer();
+        restartPending.store(false, std::memory_order_release);
+    }
+#endif
+    const uint32_t buffered = ringHead.load(std::memory_order_acquire) - ringTail.load(std::memory_order_relaxed);
+    if (buffered < stat.ringLow) stat.ringLow = buffered;
+
+    uint8_t budget = MAX_CATCHUP;
+    bool dry = false;
+    while (decoded <= index && budget > 0 && !broken.load(std::memory_order_relaxed)) {
+        if (!decodeNext()) {
+            dry = true;
+            break;
+        }
+        budget--;
+    }
+    if (dry && decoded <= index) stat.underruns++;
+    return decoded ? current : nullptr;
+}
+
+Stats stats() {
+    Stats s = stat;
+    s.activeMs = showId ? timers.now() - startMs : 0;
+    return s;
+}
+
+} // namespace BakedShow
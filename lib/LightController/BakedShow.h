@@ -0,0 +1,88 @@
+/**
+ * @file BakedShow.h
+ * @brief Pre-rendered light shows streamed from SD (baked shows)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Shows too heavy to render per frame (particle systems, image sweeps) are
+ * rendered offline (tools/bake_show.py) into /light_shows/<id>.lsb, one RGB
+ * frame per step in LED index order (the order of ledmap.bin), each frame
+ * delta-coded against the previous one. A pattern selects one with its
+ * `baked` column.
+ *
+ * The file stays open while the show plays; fill() tops up a small ring
+ * buffer on the loop core in CHUNK_SIZE reads, each under its own
+ * SDController lock, so MP3 playback (AudioFileSourceSD, also on the loop
+ * core) and background SD work get the card between chunks. While audio
+ * plays a repaint tick reads at most CHUNKS_WITH_AUDIO chunks. The frame
+ * for the current time is decoded from the ring by the renderer (loop core
+ * or render task); the stream loops at the end of the file.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "HWconfig.h"  // for NUM_LEDS
+
+namespace BakedShow {
+
+// .lsb file: 16-byte header, then frames
+//   "LSB1", uint16 ledCount, uint8 fps, uint8 reserved, uint32 frameCount, uint32 mapHash
+//   frame: uint16 payload length, payload
+// Payload: the frame's RGB bytes against the previous frame (the first frame of the file
+// against black). Token t < 0x80 skips t + 1 unchanged bytes; t >= 0x80 is followed by
+// t - 0x7F literal bytes. Integers are little endian.
+constexpr uint8_t MAGIC[4] = {'L', 'S', 'B', '1'};
+constexpr size_t HEADER_SIZE = 16;
+constexpr size_t FRAME_BYTES = NUM_LEDS * 3;
+constexpr size_t PAYLOAD_MAX = FRAME_BYTES + (FRAME_BYTES + 127) / 128;  // All literals
+constexpr size_t RING_SIZE = 4096;      // Power of two, multiple of CHUNK_SIZE
+constexpr size_t CHUNK_SIZE = 512;      // One SD read
+constexpr uint8_t CHUNKS_WITH_AUDIO = 2;  // Per repaint tick while audio plays (see .cpp)
+static_assert((RING_SIZE & (RING_SIZE - 1)) == 0 && RING_SIZE % CHUNK_SIZE == 0, "ring size");
+static_assert(RING_SIZE >= 2 * (PAYLOAD_MAX + 2), "ring must hold two worst-case frames");
+
+struct Header {
+    uint16_t ledCount;
+    uint8_t fps;
+    uint32_t frameCount;
+    uint32_t mapHash;   // mapHash() of the LED map baked against, 0 = any map
+};
+
+// Parse the file header; false if it is not a baked show
+bool parseHeader(const uint8_t *data, size_t size, Header &out);
+// FNV-1a over the LED map as stored in ledmap.bin (x, y float pairs)
+uint32_t mapHash(const float *xs, const float *ys, uint16_t count);
+// Apply one payload to frame (FRAME_BYTES, holds the previous frame); false if malformed
+bool decodeFrame(const uint8_t *payload, size_t size, uint8_t *frame);
+
+// === Player (loop core) ===
+// Open /light_shows/<id>.lsb and play it from the first frame; false if missing or refused
+// (a failed id is not retried until another one started). Called from the repaint tick:
+// PlayLightShow() only names the show, so web handlers never open the file.
+bool start(uint8_t id);
+void stop();
+uint8_t activeId();  // 0 = none
+uint8_t fps();
+// Top up the ring from SD; audioBusy limits the reads to CHUNKS_WITH_AUDIO
+void fill(bool audioBusy);
+// Frame due now: frames since start() at the file's frame rate
+uint32_t frameIndex();
+
+// === Renderer (loop core or render task) ===
+// Decode up to frameIndex and return the frame's RGB bytes; nullptr until the first
+// frame is buffered. When the ring runs dry the last frame stays (counted as underrun).
+const uint8_t *advance(uint32_t frameIndex);
+
+struct Stats {
+    uint32_t bytesRead;    // Since start()
+    uint32_t reads;
+    uint32_t readUsMax;    // Slowest chunk read
+    uint32_t activeMs;     // Since start()
+    uint32_t frames;       // Decoded since start()
+    uint32_t underruns;    // Render calls that could not get their frame
+    uint32_t ringLow;      // Fewest bytes buffered at a render call
+};
+Stats stats();
+
+} // namespace BakedShow
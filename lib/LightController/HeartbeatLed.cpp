@@ -0,0 +1,65 @@
+/**
+ * @file HeartbeatLed.cpp
+ * @brief Status LED breathing on LEDC hardware fades implementation
+ * @version 261016X
+ * @date 2026-10-16
+ */
+#include <Arduino.h>
+#include "HeartbeatLed.h"
+#include "Globals.h"
+
+namespace HeartbeatLed {
+
+namespace {
+
+constexpr uint32_t LEDC_FREQ_HZ = 5000;
+constexpr uint8_t LEDC_BITS = 8;             // Duty 0..255, as HeartbeatWave::peak
+constexpr uint32_t FADE_TIMEOUT_MS = 100;    // A missed end interrupt must not stop the heartbeat
+
+WaveSource waveSource = nullptr;
+TaskHandle_t ledTask = nullptr;
+
+void ARDUINO_ISR_ATTR onFadeEnd(void *task) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(static_cast<TaskHandle_t>(task), &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// Run one hardware fade and sleep until it ends
+void fade(uint8_t from, uint8_t to, uint16_t ms) {
+    if (ms == 0 || from == to) {
+        ledcWrite(LED_PIN, to);
+        return;
+    }
+    ulTaskNotifyTake(pdTRUE, 0);  // Drop a stale notification (late interrupt after a timeout)
+    if (!ledcFadeWithInterruptArg(LED_PIN, from, to, ms, onFadeEnd, xTaskGetCurrentTaskHandle())) {
+        ledcWrite(LED_PIN, to);
+        vTaskDelay(pdMS_TO_TICKS(ms));
+        return;
+    }
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms + FADE_TIMEOUT_MS));
+}
+
+// Two wakeups per breath (three with a dark phase), each a few microseconds
+void ledTaskMain(void *) {
+    for (;;) {
+        const HeartbeatWave rise = waveSource();
+        fade(0, rise.peak, rise.riseMs);
+        const HeartbeatWave fall = waveSource();
+        fade(rise.peak, 0, fall.fallMs);
+        if (fall.darkMs) vTaskDelay(pdMS_TO_TICKS(fall.darkMs));
+    }
+}
+
+} // namespace
+
+bool begin(WaveSource source) {
+    if (ledTask) return true;
+    if (!source || !ledcAttach(LED_PIN, LEDC_FREQ_HZ, LEDC_BITS)) return false;
+    ledcWrite(LED_PIN, 0);
+    waveSource = source;
+    // Above loop() so a busy loop does not delay the next fade; the task only sleeps otherwise
+    return xTaskCreate(ledTaskMain, "heartbeat", 2048, nullptr, 2, &ledTask) == pdPASS;
+}
+
+} // namespace HeartbeatLed
@@ -0,0 +1,35 @@
+/**
+ * @file HeartbeatLed.h
+ * @brief Status LED breathing on LEDC hardware fades
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * The status LED (LED_PIN) breathes: a fade up, a fade down, then optionally
+ * dark. The LEDC peripheral runs each fade on its own; its end interrupt wakes
+ * a small task that starts the next one. No TimerManager slot, no loop wakeups,
+ * and a busy loop cannot make the heartbeat stutter. The waveform is asked from
+ * a source at the start of every fade, so a new rate shows within half a breath.
+ * tools/light_render/host has a stand-in that plays the same sequence on a
+ * virtual clock (tools/host_tests/test_heartbeat).
+ */
+#pragma once
+
+#include <stdint.h>
+
+// One breath of the status LED
+struct HeartbeatWave {
+    uint16_t riseMs = 500;  // Dark to peak
+    uint16_t fallMs = 500;  // Peak to dark
+    uint16_t darkMs = 0;    // Off after the fall
+    uint8_t peak = 255;     // Duty at the top (8-bit)
+};
+
+namespace HeartbeatLed {
+
+using WaveSource = HeartbeatWave (*)();
+
+// Attach LED_PIN to an LEDC channel and start breathing. source runs in the LED task at the
+// start of every fade. False if the channel or the task could not be set up.
+bool begin(WaveSource source);
+
+} // namespace HeartbeatLed
@@ -1,8 +1,8 @@
 /**
  * @file LEDMap.cpp
  * @brief Physical LED strip mapping implementation
- * @version 260205A
- * @date 2026-02-05
+ * @version 261016H
+ * @date 2026-10-16
  */
 #include "LEDMap.h"
 #include <SDController.h>
@@ -10,23 +10,40 @@
 #include "Globals.h"
 #include <math.h>
 
-static LEDPos ledMap[NUM_LEDS];
+// Structure of arrays: the render loop streams x and y separately
+static float ledMapX[NUM_LEDS];
+static float ledMapY[NUM_LEDS];
+static uint16_t ledMapVersion = 0;
 
 static void buildFallbackLEDMap() {
     const float radius = sqrtf(static_cast<float>(NUM_LEDS));
     for (int i = 0; i < NUM_LEDS; i++) {
         float angle = (2.0f * M_PI * i) / static_cast<float>(NUM_LEDS);
-        ledMap[i] = {cosf(angle) * radius, sinf(angle) * radius};
+        ledMapX[i] = cosf(angle) * radius;
+        ledMapY[i] = sinf(angle) * radius;
     }
+    ledMapVersion++;
 }
 
 LEDPos getLEDPos(int index) {
     if (index >= 0 && index < NUM_LEDS) {
-        return ledMap[index];
+        return {ledMapX[index], ledMapY[index]};
     }
     return {0.0f, 0.0f};
 }
 
+const float* getLEDMapX() {
+    return ledMapX;
+}
+
+const float* getLEDMapY() {
+    return ledMapY;
+}
+
+uint16_t getLEDMapVersion() {
+    return ledMapVersion;
+}
+
 bool loadLEDMapFromSD(const char* path) {
     buildFallbackLEDMap();
     int loaded = 0;
@@ -46,9 +63,11 @@ bool loadLEDMapFromSD(const char* path) {
         float x = 0, y = 0;
         if (f.read((uint8_t*)&x, sizeof(float)) != sizeof(float)) break;
         if (f.read((uint8_t*)&y, sizeof(float)) != sizeof(float)) break;
-        ledMap[i] = {x, y};
+        ledMapX[i] = x;
+        ledMapY[i] = y;
         loaded++;
     }
+    ledMapVersion++;
 
     f.close();
     SDController::unlockSD();
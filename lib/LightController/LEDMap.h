@@ -1,11 +1,13 @@
 /**
  * @file LEDMap.h
  * @brief Physical LED strip mapping to logical positions
- * @version 260205A
- * @date 2026-02-05
+ * @version 261016H
+ * @date 2026-10-16
  */
 #pragma once
 
+#include <stdint.h>
+
 struct LEDPos {
     float x;
     float y;
@@ -13,3 +15,9 @@ struct LEDPos {
 
 LEDPos getLEDPos(int index);
 bool loadLEDMapFromSD(const char* path);
+
+// Structure-of-arrays view for render loops (NUM_LEDS entries, no bounds check)
+const float* getLEDMapX();
+const float* getLEDMapY();
+// Bumped on every (re)load; lets callers invalidate geometry derived from the map
+uint16_t getLEDMapVersion();
@@ -0,0 +1,156 @@
+/**
+ * @file LightCompositor.cpp
+ * @brief Overlay layers blended over the base light show
+ * @version 261016Q
+ * @date 2026-10-16
+ */
+#include <Arduino.h>
+#include "LightCompositor.h"
+#include "HWconfig.h"  // for NUM_LEDS
+#include "TimerManager.h"
+
+namespace {
+
+struct Layer {
+    bool active = false;
+    BlendMode mode = BlendMode::NORMAL;
+    uint32_t expiresAt = 0;         // timers.now() deadline; 0 = no expiry
+    CRGB color[NUM_LEDS];
+    uint8_t alpha[NUM_LEDS] = {};   // Per-LED coverage, 0 = transparent
+};
+
+constexpr uint8_t LAYER_COUNT = static_cast<uint8_t>(LightLayer::COUNT);
+Layer layers[LAYER_COUNT];
+
+// Writers run on the loop core; with LIGHT_RENDER_TASK compose() runs on the
+// other core and works on a copy taken under this lock.
+#if LIGHT_RENDER_TASK
+portMUX_TYPE layerMux = portMUX_INITIALIZER_UNLOCKED;
+#define LAYER_LOCK()   portENTER_CRITICAL(&layerMux)
+#define LAYER_UNLOCK() portEXIT_CRITICAL(&layerMux)
+Layer frameLayers[LAYER_COUNT];
+#else
+#define LAYER_LOCK()
+#define LAYER_UNLOCK()
+#endif
+
+Layer &layerRef(LightLayer layer) {
+    return layers[static_cast<uint8_t>(layer)];
+}
+
+uint32_t expiryFor(uint32_t durationMs) {
+    if (durationMs == 0) return 0;
+    const uint32_t at = timers.now() + durationMs;
+    return at ? at : 1;  // 0 is reserved for "no expiry"
+}
+
+inline CRGB blendPixel(const CRGB &base, const CRGB &color, uint8_t alpha, BlendMode mode) {
+    switch (mode) {
+        case BlendMode::ADD: {
+            CRGB add = color;
+            add.nscale8_video(alpha);
+            return CRGB(qadd8(base.r, add.r), qadd8(base.g, add.g), qadd8(base.b, add.b));
+        }
+        case BlendMode::MULTIPLY: {
+            const CRGB mul(scale8(base.r, color.r), scale8(base.g, color.g), scale8(base.b, color.b));
+            return CRGB(lerp8by8(base.r, mul.r, alpha), lerp8by8(base.g, mul.g, alpha), lerp8by8(base.b, mul.b, alpha));
+        }
+        case BlendMode::NORMAL:
+        default:
+            if (alpha == 255) return color;
+            return CRGB(lerp8by8(base.r, color.r, alpha), lerp8by8(base.g, color.g, alpha), lerp8by8(base.b, color.b, alpha));
+    }
+}
+
+} // namespace
+
+namespace LightCompositor {
+
+void setSolid(LightLayer layer, CRGB color, uint8_t alpha, BlendMode mode, uint32_t durationMs) {
+    if (layer >= LightLayer::COUNT) return;
+    Layer &l = layerRef(layer);
+    LAYER_LOCK();
+    fill_solid(l.color, NUM_LEDS, color);
+    memset(l.alpha, alpha, sizeof(l.alpha));
+    l.mode = mode;
+    l.expiresAt = expiryFor(durationMs);
+    l.active = true;
+    LAYER_UNLOCK();
+}
+
+void setPixel(LightLayer layer, uint16_t index, CRGB color, uint8_t alpha) {
+    if (layer >= LightLayer::COUNT || index >= NUM_LEDS) return;
+    Layer &l = layerRef(layer);
+    LAYER_LOCK();
+    if (!l.active) {
+        memset(l.alpha, 0, sizeof(l.alpha));
+        l.mode = BlendMode::NORMAL;
+        l.expiresAt = 0;
+        l.active = true;
+    }
+    l.color[index] = color;
+    l.alpha[index] = alpha;
+    LAYER_UNLOCK();
+}
+
+void setMode(LightLayer layer, BlendMode mode, uint32_t durationMs) {
+    if (layer >= LightLayer::COUNT) return;
+    Layer &l = layerRef(layer);
+    LAYER_LOCK();
+    l.mode = mode;
+    l.expiresAt = expiryFor(durationMs);
+    LAYER_UNLOCK();
+}
+
+void clear(LightLayer layer) {
+    if (layer >= LightLayer::COUNT) return;
+    LAYER_LOCK();
+    layerRef(layer).active = false;
+    LAYER_UNLOCK();
+}
+
+bool isActive(LightLayer layer) {
+    return layer < LightLayer::COUNT && layerRef(layer).active;
+}
+
+void compose(CRGB *leds, uint16_t count, LightPower::Sums *sums) {
+    const uint32_t now = timers.now();
+    const Layer *active[LAYER_COUNT];
+    uint8_t activeCount = 0;
+
+    LAYER_LOCK();
+    for (uint8_t i = 0; i < LAYER_COUNT; i++) {
+        Layer &l = layers[i];
+        if (l.active && l.expiresAt && static_cast<int32_t>(now - l.expiresAt) >= 0) {
+            l.active = false;
+        }
+        if (!l.active) continue;
+#if LIGHT_RENDER_TASK
+        frameLayers[i].mode = l.mode;
+        memcpy(frameLayers[i].color, l.color, sizeof(l.color));
+        memcpy(frameLayers[i].alpha, l.alpha, sizeof(l.alpha));
+        active[activeCount++] = &frameLayers[i];
+#else
+        active[activeCount++] = &l;
+#endif
+    }
+    LAYER_UNLOCK();
+
+    if (activeCount == 0) return;
+
+    const uint16_t n = min<uint16_t>(count, NUM_LEDS);
+    for (uint16_t p = 0; p < n; p++) {
+        CRGB out = leds[p];
+        for (uint8_t i = 0; i < activeCount; i++) {
+            const uint8_t a = active[i]->alpha[p];
+            if (a) out = blendPixel(out, active[i]->color[p], a, active[i]->mode);
+        }
+        if (sums) {
+            sums->sub(leds[p]);
+            sums->add(out);
+        }
+        leds[p] = out;
+    }
+}
+
+} // namespace LightCompositor
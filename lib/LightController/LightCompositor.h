@@ -0,0 +1,45 @@
+/**
+ * @file LightCompositor.h
+ * @brief Overlay layers blended over the base light show (alerts, status pixels)
+ * @version 261016Q
+ * @date 2026-10-16
+ *
+ * The base show renders into the frame buffer; active overlay layers are then blended
+ * on top in one pass per frame. Setting or clearing a layer never touches the
+ * base show, so its animation timers and phases keep running.
+ */
+#pragma once
+
+#include <FastLED.h>
+#include "Globals.h"
+#include "LightPower.h"
+
+// Layers are drawn bottom to top in this order
+enum class LightLayer : uint8_t {
+    STATUS,     // Individual status pixels
+    ALERT,      // AlertRGB flash sequence
+    COUNT
+};
+
+enum class BlendMode : uint8_t {
+    NORMAL,     // out = lerp(base, color, alpha)
+    ADD,        // out = base + color * alpha (saturating)
+    MULTIPLY    // out = lerp(base, base * color, alpha)
+};
+
+namespace LightCompositor {
+
+// Whole layer one color. durationMs = 0: until cleared, else the layer expires by itself
+void setSolid(LightLayer layer, CRGB color, uint8_t alpha = 255,
+              BlendMode mode = BlendMode::NORMAL, uint32_t durationMs = 0);
+// One pixel of a layer (others keep their value; a fresh layer starts transparent)
+void setPixel(LightLayer layer, uint16_t index, CRGB color, uint8_t alpha = 255);
+void setMode(LightLayer layer, BlendMode mode, uint32_t durationMs = 0);
+void clear(LightLayer layer);
+bool isActive(LightLayer layer);
+
+// Render side: blend all active layers over leds (single pass). No-op when no layer is active.
+// sums (optional) is kept in step with every pixel that changes.
+void compose(CRGB *leds, uint16_t count, LightPower::Sums *sums = nullptr);
+
+} // namespace LightCompositor
@@ -1,8 +1,8 @@
 /**
  * @file LightController.cpp
  * @brief LED control implementation via FastLED library
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include "Globals.h"
@@ -13,6 +13,16 @@
 #include "MathUtils.h"
 #include "SensorController.h"
 #include "TimerManager.h"
+#include "Seqlock.h"
+#include "LightCompositor.h"
+#include "LightVM.h"
+#include "LightPower.h"
+#include "BakedShow.h"
+#include "LightNoise.h"
+
+#if LIGHT_RENDER_TASK && CONFIG_FREERTOS_UNICORE
+#error "LIGHT_RENDER_TASK needs a second core"
+#endif
 
 LightController lightController;
 
@@ -63,8 +73,10 @@ void setBrightnessBaseHi(uint8_t value) {
   brightnessBaseHi = value;
 }
 
-// === LED buffer ===
-CRGB leds[NUM_LEDS];
+// === LED buffers ===
+CRGB leds[NUM_LEDS];          // Strip output (FastLED runs at brightness 255)
+static CRGB frame[NUM_LEDS];  // Rendered + composed frame before global brightness
+static LightPower::Sums frameSums;  // Channel sums of frame[], kept as pixels are written
 
 // === State & Animation for CircleShow ===
 static LightShowParams showParams;
@@ -79,72 +91,965 @@ static uint8_t brightPhase = 0;
 static uint8_t colorCycleSec = 10;
 static uint8_t brightCycleSec = 10;
 
+// Everything one frame depends on. Built on the loop core; rendered there
+// (default) or handed to the render task through a seqlock (LIGHT_RENDER_TASK).
+struct RenderFrame {
+  LightShowParams params;
+  uint8_t colorPhase, brightPhase, xPhase, yPhase;
+  uint8_t brightness;     // Global brightness for this frame (applied in writeOutput)
+  uint8_t maxBrightness;  // Per-LED fade ceiling (brightnessBaseHi)
+  float audio;            // Audio level 0..1 for light programs (0 when silent)
+  AudioBands bands;       // Spectrum bands for light programs (0 when silent)
+  uint16_t morphSeq;      // Bumped per morph: the renderer snapshots its gradient
+  uint8_t morph;          // Gradient crossfade toward params' colors, 255 = done
+  bool bakedActive;       // A baked show is streaming (BakedShow::activeId())
+  uint32_t bakedFrame;    // Its frame due now
+  uint32_t atMs;          // timers.now() when built: zone phases follow it
+};
+
+static uint8_t outputBrightness = 255;  // Set by applyBrightness() / showBrightness()
+
 // === Timer callbacks ===
 void cb_colorCycle() { colorPhase++; }
 void cb_brightCycle() { brightPhase++; }
 static void cb_xPhase() { xPhase++; }
 static void cb_yPhase() { yPhase++; }
 
-// === Update ===
-void updateLightController() {
-  applyBrightness();
+// Phase timer handles: re-arming on every show change is a direct slot access
+static TimerHandle colorCycleTimer, brightCycleTimer, xPhaseTimer, yPhaseTimer;
 
-  float baseRadius = showParams.radius;
-  float radiusOsc  = showParams.radiusOsc;
+static void restartPhaseTimer(TimerHandle &handle, uint32_t intervalMs, TimerCallback cb) {
+  if (!timers.restart(handle, intervalMs, 0)) {
+    handle = timers.restart(intervalMs, 0, cb);  // First use or stale handle
+  }
+}
 
-  float animRadius = baseRadius;
-  if (radiusOsc != 0.0f) {
-    float osc = brightPhase / 255.0f;
-    if (radiusOsc > 0.0f) {
-      animRadius += fabsf(radiusOsc) * sinf(osc * MathUtils::k2Pi * showParams.gradientSpeed);
-    } else {
-      animRadius = -showParams.fadeWidth + fabsf(radiusOsc) * osc;
+// === Dirty tracking ===
+// Gradient is rebuilt only when the color pair or the color correction changes;
+// show() is skipped when frame[] and brightness match the last frame sent to the strip.
+static CRGB gradientRGB1, gradientRGB2;
+static bool gradientValid = false;
+
+// Morph: targetGradient holds the current colors, morphGradient what was on the
+// strip when the morph started; colorGradient is their crossfade
+static CRGB targetGradient[GRADIENT_SIZE];
+static CRGB morphGradient[GRADIENT_SIZE];
+static uint16_t gradientMorphSeq = 0;
+static uint8_t gradientMorph = 255;
+
+// Gamma and white balance (Globals::lightGamma, lightWhiteR/G/B), folded into the
+// gradient when it is built: no per-pixel cost at render time
+static uint8_t colorLut[3][256];
+static float lutGamma = 0.0f;
+static uint8_t lutWhite[3] = {0, 0, 0};
+static uint16_t lutSeq = 0;  // Bumped per rebuild: output cached with the old LUT is stale
+
+static CRGB shownFrame[NUM_LEDS];
+static uint8_t shownBrightness = 0;
+static uint32_t shownAtMs = 0;
+static bool shownValid = false;
+static uint32_t framesShown = 0;
+static uint32_t framesSkipped = 0;
+static uint32_t framesDithered = 0;
+
+// Resend an unchanged frame at least this often (recovers from glitches on the data line)
+constexpr uint32_t FRAME_REFRESH_MS = 1000;
+
+// Rebuild the LUT when the correction globals changed; true if it did
+static bool updateColorLut() {
+  const uint8_t white[3] = {Globals::lightWhiteR, Globals::lightWhiteG, Globals::lightWhiteB};
+  if (Globals::lightGamma == lutGamma && memcmp(white, lutWhite, sizeof(white)) == 0) return false;
+  buildColorLut(colorLut, Globals::lightGamma, white);
+  lutGamma = Globals::lightGamma;
+  memcpy(lutWhite, white, sizeof(white));
+  lutSeq++;
+  return true;
+}
+
+// Entry i of an n-entry gradient A -> B -> A
+static CRGB gradientColor(const CRGB &colorA, const CRGB &colorB, int i, int n) {
+  float t = (float)i / (float)(n - 1);
+  uint8_t blend;
+  if (t < 0.5f) {
+    blend = (uint8_t)(t * 2.0f * 255.0f);
+  } else {
+    blend = (uint8_t)((1.0f - (t - 0.5f) * 2.0f) * 255.0f);
+  }
+  return CRGB(
+    lerp8by8(colorA.r, colorB.r, blend),
+    lerp8by8(colorA.g, colorB.g, blend),
+    lerp8by8(colorA.b, colorB.b, blend));
+}
+
+static void updateGradient(const LightShowParams &p, uint16_t morphSeq, uint8_t morph) {
+  if (morphSeq != gradientMorphSeq) {
+    // New morph: fade out of whatever is shown now (a morph in progress included)
+    memcpy(morphGradient, colorGradient, sizeof(morphGradient));
+    gradientMorphSeq = morphSeq;
+    gradientMorph = 0;
+  }
+
+  const bool lutChanged = updateColorLut();
+  const bool targetChanged = lutChanged || !gradientValid || p.RGB1 != gradientRGB1 || p.RGB2 != gradientRGB2;
+  if (targetChanged) {
+    generateColorGradient(p.RGB1, p.RGB2, targetGradient, GRADIENT_SIZE);
+    for (int i = 0; i < GRADIENT_SIZE; ++i) {
+      for (uint8_t c = 0; c < 3; ++c) {
+        targetGradient[i].raw[c] = colorLut[c][targetGradient[i].raw[c]];
+      }
     }
+    gradientRGB1 = p.RGB1;
+    gradientRGB2 = p.RGB2;
+    gradientValid = true;
   }
+  if (!targetChanged && morph == gradientMorph) return;
 
-  float centerX = showParams.centerX, centerY = showParams.centerY;
-  if (showParams.xAmp != 0.0f) {
-    float px = xPhase / 255.0f;
-    centerX += showParams.xAmp * sinf(px * MathUtils::k2Pi);
+  gradientMorph = morph;
+  if (morph == 255) {
+    memcpy(colorGradient, targetGradient, sizeof(colorGradient));
+    return;
   }
-  if (showParams.yAmp != 0.0f) {
-    float py = yPhase / 255.0f;
-    centerY += showParams.yAmp * sinf(py * MathUtils::k2Pi);
+  for (int i = 0; i < GRADIENT_SIZE; ++i) {
+    for (uint8_t c = 0; c < 3; ++c) {
+      colorGradient[i].raw[c] = lerp8by8(morphGradient[i].raw[c], targetGradient[i].raw[c], morph);
+    }
   }
+}
 
-  generateColorGradient(showParams.RGB1, showParams.RGB2, colorGradient, GRADIENT_SIZE);
+// === Output ===
+// Global brightness is applied here at 16 bits (frame channel x brightness)
+// instead of in FastLED, so dim night levels keep their fraction. The part
+// below one output step is carried per LED and channel into the next output
+// (temporal dithering). That only averages out at Globals::lightDitherMinFps
+// or faster, so while the output has a fraction the last shown frame is
+// re-dithered at that rate (refreshDither()), between repaints of a slow show
+// and on still frames alike. Output slower than that (dithering off, 255) is
+// rounded instead.
+static uint8_t ditherErr[NUM_LEDS][3];
+static uint32_t outputAtMs = 0;
+static bool outputFraction = false;  // Last output had a level between two steps
 
-  // Sliding window over the color gradient: windowStart scrolls through,
-  // windowWidth determines how many gradient colors are visible at once
-  int windowWidth       = showParams.windowWidth > 0 ? showParams.windowWidth : 16;
-  uint8_t windowStart   = colorPhase;
-  uint8_t maxBrightness = getBrightnessBaseHi();
+// Re-dither interval while the output has a fraction; 0 = no refresh (lightDitherMinFps 0 or 255)
+static uint16_t ditherRefreshMs() {
+  const uint8_t minFps = Globals::lightDitherMinFps;
+  return minFps == 0 || minFps == 255 ? 0 : 1000U / minFps;
+}
+
+static void writeOutput(const CRGB *src, uint8_t brightness, uint32_t now) {
+  const uint8_t minFps = Globals::lightDitherMinFps;
+  const bool temporal = minFps == 0 || (now - outputAtMs) * minFps <= 1000UL;
+  outputAtMs = now;
+
+  uint8_t fraction = 0;
+  for (int i = 0; i < NUM_LEDS; ++i) {
+    for (uint8_t c = 0; c < 3; ++c) {
+      const uint16_t level = src[i].raw[c] * brightness;  // <= 65025
+      fraction |= level;
+      if (temporal) {
+        const uint16_t v = level + ditherErr[i][c];  // <= 65280, no overflow
+        leds[i].raw[c] = v >> 8;
+        ditherErr[i][c] = v & 0xFF;
+      } else {
+        leds[i].raw[c] = (level + 0x80) >> 8;
+      }
+    }
+  }
+  outputFraction = fraction != 0;
+}
+
+// === Power limit ===
+// Replaces FastLED's limiter (same model and budget: Globals::maxMilliamps at MAX_VOLTS),
+// from frameSums instead of a pass over the strip. The cap drops at once when a frame would
+// draw more and rises POWER_CAP_RISE steps per frame, so a gradient sweeping through bright
+// colors does not pump the brightness.
+constexpr uint8_t POWER_CAP_RISE = 4;
+static uint8_t powerCap = 255;
+static uint32_t shownMilliwatts = 0;
+
+static uint8_t limitPower(uint8_t brightness) {
+  const uint32_t budget = static_cast<uint32_t>(MAX_VOLTS) * Globals::maxMilliamps;
+  const uint8_t allowed = LightPower::maxBrightness(frameSums, NUM_LEDS, 255, budget);
+  powerCap = allowed < powerCap ? allowed : min<uint16_t>(allowed, powerCap + POWER_CAP_RISE);
+  return min(brightness, powerCap);
+}
+
+uint32_t getLedMilliwatts() {
+  return shownMilliwatts;
+}
+
+uint8_t getLedPowerCap() {
+  return powerCap;
+}
+
+// Last shown frame again with the next dither step, once ditherRefreshMs() passed since the last output
+static bool refreshDither(uint32_t now) {
+  const uint16_t refreshMs = ditherRefreshMs();
+  if (!shownValid || !outputFraction || refreshMs == 0 || now - outputAtMs < refreshMs) return false;
+  writeOutput(shownFrame, shownBrightness, now);
+  FastLED.show();
+  shownAtMs = now;
+  framesDithered++;
+  return true;
+}
+
+#if !LIGHT_RENDER_TASK
+// Dither cadence on the loop core; the render task keeps it with its wait timeout instead
+static TimerHandle ditherTimer;
+
+static void cb_ditherOutput() {
+  refreshDither(timers.now());
+}
+
+// Re-armed on every output, so it only fires while the strip would otherwise wait
+static void scheduleDither() {
+  const uint16_t refreshMs = outputFraction ? ditherRefreshMs() : 0;
+  if (refreshMs) restartPhaseTimer(ditherTimer, refreshMs, cb_ditherOutput);
+  else if (ditherTimer) timers.cancel(ditherTimer);
+}
+#endif
+
+static void showFrame(uint8_t brightness) {
+  brightness = limitPower(brightness);
+  const uint32_t now = timers.now();
+  if (shownValid && brightness == shownBrightness && memcmp(frame, shownFrame, sizeof(shownFrame)) == 0) {
+    if (refreshDither(now)) return;
+    if (now - shownAtMs < FRAME_REFRESH_MS) {
+      framesSkipped++;
+      return;
+    }
+    FastLED.show();  // Resend the same output
+    shownAtMs = now;
+    framesShown++;
+    return;
+  }
+  writeOutput(frame, brightness, now);
+  memcpy(shownFrame, frame, sizeof(shownFrame));
+  shownBrightness = brightness;
+  FastLED.show();
+  shownMilliwatts = LightPower::milliwatts(frameSums, NUM_LEDS, brightness);
+  shownAtMs = now;
+  shownValid = true;
+  framesShown++;
+#if !LIGHT_RENDER_TASK
+  scheduleDither();
+#endif
+}
+
+uint32_t getFramesShown() {
+  return framesShown;
+}
+
+uint32_t getFramesSkipped() {
+  return framesSkipped;
+}
+
+uint32_t getFramesDithered() {
+  return framesDithered;
+}
+
+const CRGB *getShownFrame() {
+  return shownFrame;
+}
+
+uint8_t getShownBrightness() {
+  return shownBrightness;
+}
+
+// === Zones ===
+// setLightZones() fills pendingZones on the loop core and bumps zoneSeq; the renderer
+// copies them (under zoneMux with LIGHT_RENDER_TASK) and rebuilds its pixel lists,
+// as it does when the LED map is reloaded.
+static LightZone pendingZones[LightZones::MAX_ZONES];
+static uint8_t pendingZoneCount = 0;
+static uint16_t zoneSeq = 0;
+
+#if LIGHT_RENDER_TASK
+static portMUX_TYPE zoneMux = portMUX_INITIALIZER_UNLOCKED;
+#define ZONE_LOCK()   portENTER_CRITICAL(&zoneMux)
+#define ZONE_UNLOCK() portEXIT_CRITICAL(&zoneMux)
+#else
+#define ZONE_LOCK()
+#define ZONE_UNLOCK()
+#endif
+
+// Output does not change over time: off, or one color without ring or center motion
+static bool zoneIsStill(const LightZone &z) {
+  const LightShowParams &p = z.show;
+  return z.brightness == 0 || (p.RGB1 == p.RGB2 && p.radiusOsc == 0.0f && p.xAmp == 0.0f && p.yAmp == 0.0f);
+}
+
+// === Frame rate governor ===
+// Repaint interval follows the active show: for each animated input, the time it
+// needs to change an LED by Globals::lightFrameDelta brightness steps. Audio
+// modulation of brightness runs at Globals::lightAudioFps.
+static uint16_t showFrameMs = 50;      // Governor result for showParams (PlayLightShow)
+static uint16_t frameIntervalMs = 50;  // Interval requested for the next frame
+static uint32_t renderUsAvg = 0;       // Moving average (1/16) of updateLightController()
+static uint32_t renderUsMax = 0;
+
+// Frame interval for an input advancing every stepMs by delta LED brightness steps per step
+static float inputFrameMs(uint32_t stepMs, float delta) {
+  if (delta <= 0.0f) return 1e9f;  // Input does not animate
+  return stepMs * max(1.0f, Globals::lightFrameDelta / delta);
+}
+
+// Light programs: every phase the program reads may move an LED by a full step per tick
+static float programFrameMs(const LightVM::Program &prog, uint8_t colorCycle, uint8_t brightCycle) {
+  float ms = 1e9f;
+  const uint16_t used = prog.inputMask;
+  if (used & (1U << LightVM::IN_COLOR_PHASE))  ms = min(ms, (colorCycle * 1000.0f) / 255.0f);
+  if (used & (1U << LightVM::IN_BRIGHT_PHASE)) ms = min(ms, (brightCycle * 1000.0f) / 255.0f);
+  if (used & (1U << LightVM::IN_X_PHASE))      ms = min(ms, (xCycleSec * 1000.0f) / 255.0f);
+  if (used & (1U << LightVM::IN_Y_PHASE))      ms = min(ms, (yCycleSec * 1000.0f) / 255.0f);
+  if (used & (1U << LightVM::IN_RADIUS))       ms = min(ms, (brightCycle * 1000.0f) / 255.0f);
+  return ms;
+}
+
+static uint8_t cycleOrDefault(uint8_t sec) {
+  return sec > 0 ? sec : 10;
+}
+
+// Color window slides one gradient entry per colorPhase step; RGB1 -> RGB2 spans GRADIENT_SIZE / 2
+static float colorWindowFrameMs(const LightShowParams &p, uint8_t colorCycle) {
+  const uint8_t colorSpan = max(max(abs(p.RGB1.r - p.RGB2.r), abs(p.RGB1.g - p.RGB2.g)), abs(p.RGB1.b - p.RGB2.b));
+  return inputFrameMs((colorCycle * 1000UL) / 255UL, colorSpan / (GRADIENT_SIZE / 2.0f));
+}
+
+// Ring renderer: interval at which no animated input of p moves an LED by more than a step
+static float ringFrameMs(const LightShowParams &p, uint8_t colorCycle, uint8_t brightCycle,
+                         uint8_t xCycle, uint8_t yCycle) {
+  float ms = colorWindowFrameMs(p, colorCycle);
+
+  // Ring movement: fade = (1 - d/fadeWidth)^2 changes at most 2 * 255 / fadeWidth steps per unit
+  const float stepsPerUnit = 2.0f * 255.0f / max(p.fadeWidth, 0.01f);
+  const float radiusStep = p.radiusOsc > 0.0f ? p.radiusOsc * MathUtils::k2Pi * fabsf(p.gradientSpeed) / 255.0f
+                                               : fabsf(p.radiusOsc) / 255.0f;
+  ms = min(ms, inputFrameMs((brightCycle * 1000UL) / 255UL, radiusStep * stepsPerUnit));
+  ms = min(ms, inputFrameMs((xCycle * 1000UL) / 255UL, fabsf(p.xAmp) * MathUtils::k2Pi / 255.0f * stepsPerUnit));
+  ms = min(ms, inputFrameMs((yCycle * 1000UL) / 255UL, fabsf(p.yAmp) * MathUtils::k2Pi / 255.0f * stepsPerUnit));
+  return ms;
+}
+
+// Noise renderer: the field moves noiseSpeed cells per second along time, plus the center's
+// drift over the map. NOISE_STEPS_PER_CELL is how many brightness steps that moves an LED per
+// cell (95th percentile of the stretched field, measured on the host).
+constexpr float NOISE_STEPS_PER_CELL = 500.0f;
+
+static float noiseFrameMs(const LightShowParams &p, uint8_t colorCycle) {
+  const float drift = (fabsf(p.xAmp) / xCycleSec + fabsf(p.yAmp) / yCycleSec) * MathUtils::k2Pi / p.noiseSize;
+  const float cellsPerMs = (fabsf(p.noiseSpeed) + drift) / 1000.0f;
+  return min(colorWindowFrameMs(p, colorCycle), inputFrameMs(1, cellsPerMs * NOISE_STEPS_PER_CELL));
+}
+
+// Animated zones repaint like a main show of their own; still and off zones need no repaint
+static float zonesFrameMs() {
+  float ms = 1e9f;
+  for (uint8_t z = 0; z < pendingZoneCount; z++) {
+    if (zoneIsStill(pendingZones[z])) continue;
+    const LightShowParams &p = pendingZones[z].show;
+    ms = min(ms, ringFrameMs(p, cycleOrDefault(p.colorCycleSec), cycleOrDefault(p.brightCycleSec),
+                             cycleOrDefault(p.xCycleSec), cycleOrDefault(p.yCycleSec)));
+  }
+  return ms;
+}
+
+static void planFrameRate(uint8_t colorCycle, uint8_t brightCycle) {
+  const LightShowParams &p = showParams;
+  float ms = zonesFrameMs();
+
+  if (p.baked && p.baked == BakedShow::activeId()) {
+    ms = min(ms, 1000.0f / BakedShow::fps());
+  } else if (const LightVM::Program *prog = LightVM::get(p.program)) {
+    ms = min(ms, programFrameMs(*prog, colorCycle, brightCycle));
+  } else if (p.noiseSize > 0.0f) {
+    ms = min(ms, noiseFrameMs(p, colorCycle));
+  } else {
+    ms = min(ms, ringFrameMs(p, colorCycle, brightCycle, xCycleSec, yCycleSec));
+  }
+
+  const float fastest = 1000.0f / max<uint8_t>(Globals::lightFpsMax, 1);
+  const float slowest = 1000.0f / max<uint8_t>(Globals::lightFpsMin, 1);
+  showFrameMs = static_cast<uint16_t>(MathUtils::clamp(ms, fastest, slowest));
+}
+
+uint16_t getFrameIntervalMs() {
+  return frameIntervalMs;
+}
+
+uint32_t getRenderUsAvg() {
+  return renderUsAvg;
+}
+
+uint32_t getRenderUsMax() {
+  return renderUsMax;
+}
+
+// === Geometry cache ===
+// Per-LED distance to the show center, derived from the LED map. Rebuilt with
+// sqrtf when the map is reloaded or the center moves; a still center costs nothing.
+static float ledDist[NUM_LEDS];
+#if LIGHT_FIXED_POINT
+static int32_t ledDistQ16[NUM_LEDS];  // Same distances in Q16.16 for the fixed-point renderer
+#endif
+static float geomCenterX = 0.0f, geomCenterY = 0.0f;
+static uint16_t geomMapVersion = 0;
+static bool geomValid = false;
+
+static void updateGeometry(float centerX, float centerY) {
+  const float *xs = getLEDMapX();
+  const float *ys = getLEDMapY();
+  const bool rebuild = !geomValid || geomMapVersion != getLEDMapVersion();
+
+  if (!rebuild && centerX == geomCenterX && centerY == geomCenterY) return;
 
   for (int i = 0; i < NUM_LEDS; ++i) {
-    LEDPos pos = getLEDPos(i);
-    float dx = pos.x - centerX;
-    float dy = pos.y - centerY;
-    float dist = sqrtf(dx * dx + dy * dy);
+    const float dx = xs[i] - centerX;
+    const float dy = ys[i] - centerY;
+    ledDist[i] = sqrtf(dx * dx + dy * dy);
+#if LIGHT_FIXED_POINT
+    ledDistQ16[i] = static_cast<int32_t>(lroundf(ledDist[i] * 65536.0f));
+#endif
+  }
+
+  geomCenterX = centerX;
+  geomCenterY = centerY;
+  geomMapVersion = getLEDMapVersion();
+  geomValid = true;
+}
+
+// === Renderers ===
+// Phase oscillators: sine of a phase (0..255 = one turn) scaled by turns, from FastLED sin16
+// (65536 units per turn; the cast wraps whole turns and negative angles). Both renderers use
+// it, so they place the ring and center identically.
+static float phaseSine16(uint8_t phase, float turns) {
+  return sin16(static_cast<uint16_t>(lroundf(phase * turns * (65536.0f / 255.0f)))) / 32767.0f;
+}
+
+#if LIGHT_FIXED_POINT
+// The phase is 0..255, so each turns value has 256 results. They are looked up per frame; an
+// entry is computed once per turns value (turns change with the pattern or during a morph).
+// The main show and every zone keep their own radius table, so zones with other turns do not
+// clear each other's; the center always turns once per cycle and shares one table.
+struct PhaseTable {
+  float turns = NAN;
+  uint8_t known[32];  // Bit per phase
+  float sine[256];
+};
+
+static float phaseSin(PhaseTable &t, uint8_t phase, float turns) {
+  if (turns != t.turns) {
+    memset(t.known, 0, sizeof(t.known));
+    t.turns = turns;
+  }
+  const uint8_t bit = 1U << (phase & 7);
+  if (!(t.known[phase >> 3] & bit)) {
+    t.sine[phase] = phaseSine16(phase, turns);
+    t.known[phase >> 3] |= bit;
+  }
+  return t.sine[phase];
+}
+#else
+struct PhaseTable {};
+
+static float phaseSin(PhaseTable &, uint8_t phase, float turns) {
+  return phaseSine16(phase, turns);
+}
+#endif
+static PhaseTable showRadiusTable, centerTable;
+
+#if LIGHT_FIXED_POINT
+// Q16.16 distances, blend and fade as Q16 fractions (0x10000 = 1.0, the float path's
+// clamp value). The gradient index is taken from the blend at 48 fractional bits, so
+// it truncates where the float path does; output stays within 1 LSB of the float renderer.
+static void renderLeds(const uint16_t *pixels, uint16_t count, const LightShowParams &p, float animRadius,
+                       uint8_t windowStart, int windowWidth, uint8_t maxBrightness) {
+  const int32_t radiusQ16 = static_cast<int32_t>(lroundf(animRadius * 65536.0f));
+  const uint32_t fadeQ16  = static_cast<uint32_t>(max(p.fadeWidth * 65536.0f, 1.0f));
+  const uint64_t invFade  = (1ULL << 48) / fadeQ16;  // diff * invFade = diff / fadeWidth in Q48
+  const uint8_t minB      = p.minBrightness;
+  const uint32_t range    = maxBrightness > minB ? maxBrightness - minB : 0;
+  const uint64_t span     = static_cast<uint64_t>(windowWidth - 1);
+
+  for (uint16_t n = 0; n < count; ++n) {
+    const uint16_t i = pixels[n];
+    const uint32_t diff = static_cast<uint32_t>(abs(ledDistQ16[i] - radiusQ16));
+    const uint64_t blend48 = diff >= fadeQ16 ? (1ULL << 48) : diff * invFade;
+    const uint32_t blend = static_cast<uint32_t>(blend48 >> 32);
+
+    const uint64_t inv  = 0x10000 - blend;
+    const uint32_t fade = static_cast<uint32_t>((inv * inv) >> 16);
+
+    CRGB color = colorGradient[static_cast<uint8_t>(windowStart + ((blend48 * span) >> 48))];
+
+    const uint8_t brightness = minB + ((range * fade) >> 16);
+    if (brightness > 0) color.nscale8_video(brightness);
+    else                color = CRGB::Black;
+
+    frame[i] = color;
+    frameSums.add(color);
+  }
+}
+#else
+static void renderLeds(const uint16_t *pixels, uint16_t count, const LightShowParams &p, float animRadius,
+                       uint8_t windowStart, int windowWidth, uint8_t maxBrightness) {
+  const float invFadeWidth = 1.0f / p.fadeWidth;
+  const float span = static_cast<float>(windowWidth - 1);
+  const float range = static_cast<float>(maxBrightness - p.minBrightness);
+  // Locals: frame[] stores are uint8_t and may alias p and frameSums, which would reload them per LED
+  const uint8_t minB = p.minBrightness;
+  LightPower::Sums sums;
 
-    float blend = MathUtils::clamp(fabsf(dist - animRadius) / showParams.fadeWidth, 0.0f, 1.0f);
+  for (uint16_t n = 0; n < count; ++n) {
+    const uint16_t i = pixels[n];
+    const float blend = MathUtils::clamp(fabsf(ledDist[i] - animRadius) * invFadeWidth, 0.0f, 1.0f);
 
     float fade = 1.0f - blend;
     fade = fade * fade;
 
-    int gradIdx = (windowStart + int(blend * (windowWidth - 1))) % GRADIENT_SIZE;
-    if (gradIdx < 0) gradIdx += GRADIENT_SIZE;
+    // GRADIENT_SIZE is 256: the uint8_t wraps the window like % did (the offset is >= 0)
+    CRGB color = colorGradient[static_cast<uint8_t>(windowStart + int(blend * span))];
 
-    CRGB color = colorGradient[gradIdx];
+    uint8_t brightness = minB + uint8_t(fade * range);
+    if (brightness > 0) color.nscale8_video(brightness);
+    else                color = CRGB::Black;
 
-    uint8_t brightness = showParams.minBrightness +
-                         uint8_t(fade * (maxBrightness - showParams.minBrightness));
+    frame[i] = color;
+    sums.add(color);
+  }
+  frameSums.add(sums);
+}
+#endif
+
+// Light program: gradient index (turns, wraps) and brightness 0..1 per LED
+static void renderProgram(const uint16_t *pixels, uint16_t count, const LightVM::Program &prog,
+                          const RenderFrame &f, float animRadius, uint8_t maxBrightness) {
+  const float *xs = getLEDMapX();
+  const float *ys = getLEDMapY();
+  const uint8_t minB = f.params.minBrightness;
+  const float range = maxBrightness > minB ? maxBrightness - minB : 0.0f;
+
+  float in[LightVM::IN_COUNT];
+  in[LightVM::IN_COLOR_PHASE]  = f.colorPhase / 256.0f;
+  in[LightVM::IN_BRIGHT_PHASE] = f.brightPhase / 256.0f;
+  in[LightVM::IN_X_PHASE]      = f.xPhase / 256.0f;
+  in[LightVM::IN_Y_PHASE]      = f.yPhase / 256.0f;
+  in[LightVM::IN_AUDIO]        = f.audio;
+  in[LightVM::IN_RADIUS]       = animRadius;
+  in[LightVM::IN_FADE_WIDTH]   = f.params.fadeWidth;
+  in[LightVM::IN_BASS]         = f.bands.bass / 255.0f;
+  in[LightVM::IN_MID]          = f.bands.mid / 255.0f;
+  in[LightVM::IN_HIGH]         = f.bands.high / 255.0f;
+  in[LightVM::IN_ONSET]        = f.bands.onset / 255.0f;
+
+  for (uint16_t n = 0; n < count; ++n) {
+    const uint16_t i = pixels[n];
+    in[LightVM::IN_X]     = xs[i];
+    in[LightVM::IN_Y]     = ys[i];
+    in[LightVM::IN_DIST]  = ledDist[i];
+    in[LightVM::IN_INDEX] = i / static_cast<float>(NUM_LEDS);
+    const LightVM::Result r = LightVM::run(prog, in);
+
+    const float turns = r.index - floorf(r.index);
+    CRGB color = colorGradient[static_cast<int32_t>(turns * GRADIENT_SIZE) & (GRADIENT_SIZE - 1)];
+    const uint8_t brightness = minB + static_cast<uint8_t>(MathUtils::clamp01(r.bright) * range);
     if (brightness > 0) color.nscale8_video(brightness);
     else                color = CRGB::Black;
 
-    leds[i] = color;
+    frame[i] = color;
+    frameSums.add(color);
   }
+}
 
-  FastLED.show();
+// Baked show: final colors from the file; color correction and the per-LED ceiling
+// are applied here, so the file does not depend on either. Black until the first frame is buffered.
+static void renderBaked(const uint16_t *pixels, uint16_t count, const uint8_t *rgb, uint8_t maxBrightness) {
+  for (uint16_t n = 0; n < count; ++n) {
+    const uint16_t i = pixels[n];
+    if (!rgb) {
+      frame[i] = CRGB::Black;
+      continue;
+    }
+    const uint8_t *px = rgb + 3 * i;
+    CRGB color(colorLut[0][px[0]], colorLut[1][px[1]], colorLut[2][px[2]]);
+    color.nscale8_video(maxBrightness);
+    frame[i] = color;
+    frameSums.add(color);
+  }
+}
+
+// Noise field: the value picks the gradient entry inside the window and, stretched and
+// squared like the ring's fade, the brightness. inoise16 mostly returns 20000..45000, so
+// the middle of its range is stretched NOISE_STRETCH times to span dark to bright.
+constexpr int32_t NOISE_STRETCH = 3;
+static LightNoise::Field noiseField;
+static uint16_t noiseValues[NUM_LEDS];
+
+static void renderNoise(const uint16_t *pixels, uint16_t count, const LightShowParams &p, uint32_t atMs,
+                        float centerX, float centerY, uint8_t windowStart, int windowWidth, uint8_t maxBrightness) {
+  const LightNoise::Pose pose = {p.noiseSize, p.noiseSpeed, centerX, centerY, p.noiseFps, atMs};
+  LightNoise::sample(noiseField, pixels, count, pose, noiseValues);
+
+  const uint8_t minB   = p.minBrightness;
+  const uint16_t range = maxBrightness > minB ? maxBrightness - minB : 0;
+  const uint32_t span  = static_cast<uint32_t>(windowWidth - 1);
+
+  for (uint16_t n = 0; n < count; ++n) {
+    const uint16_t i = pixels[n];
+    const int32_t stretched = (static_cast<int32_t>(noiseValues[i]) - 0x8000) * NOISE_STRETCH + 0x8000;
+    const uint16_t v = static_cast<uint16_t>(MathUtils::clamp(stretched, 0, 0xFFFF));
+
+    CRGB color = colorGradient[static_cast<uint8_t>(windowStart + ((v * span) >> 16))];
+
+    const uint8_t brightness = minB + scale16(range, scale16(v, v));
+    if (brightness > 0) color.nscale8_video(brightness);
+    else                color = CRGB::Black;
+
+    frame[i] = color;
+    frameSums.add(color);
+  }
+}
+
+// Ring radius and center of a show at the given phases; radiusTable belongs to the show or zone
+static void ringPose(const LightShowParams &p, PhaseTable &radiusTable, uint8_t brightPhase, uint8_t xPhase,
+                     uint8_t yPhase, float &animRadius, float &centerX, float &centerY) {
+  animRadius = p.radius;
+  if (p.radiusOsc != 0.0f) {
+    if (p.radiusOsc > 0.0f) {
+      animRadius += fabsf(p.radiusOsc) * phaseSin(radiusTable, brightPhase, p.gradientSpeed);
+    } else {
+      animRadius = -p.fadeWidth + fabsf(p.radiusOsc) * (brightPhase / 255.0f);
+    }
+  }
+
+  centerX = p.centerX;
+  centerY = p.centerY;
+  if (p.xAmp != 0.0f) {
+    centerX += p.xAmp * phaseSin(centerTable, xPhase, 1.0f);
+  }
+  if (p.yAmp != 0.0f) {
+    centerY += p.yAmp * phaseSin(centerTable, yPhase, 1.0f);
+  }
+}
+
+// === Zone rendering ===
+// Renderer copy of the zones and the LED lists per owner (0 = main show)
+static LightZone zones[LightZones::MAX_ZONES];
+static uint8_t zoneCount = 0;
+static uint16_t zoneSeqSeen = 0;
+static uint16_t zoneMapVersion = 0;
+static bool zonePixelsValid = false;
+static LightZones::PixelLists zonePixels;
+
+// Still zones render once into stillFrame[] (frame[] is overdrawn by the compositor);
+// later frames copy their pixels and sums until the ceiling or the color correction changes
+struct ZoneCache {
+  bool still;
+  bool valid;
+  uint8_t maxBrightness;
+  uint16_t lutSeq;
+  LightPower::Sums sums;
+  PhaseTable radiusTable;
+};
+static ZoneCache zoneCache[LightZones::MAX_ZONES];
+static CRGB stillFrame[NUM_LEDS];
+
+static void updateZones() {
+  bool changed = false;
+  ZONE_LOCK();
+  if (zoneSeq != zoneSeqSeen) {
+    for (uint8_t z = 0; z < pendingZoneCount; z++) zones[z] = pendingZones[z];
+    zoneCount = pendingZoneCount;
+    zoneSeqSeen = zoneSeq;
+    changed = true;
+  }
+  ZONE_UNLOCK();
+  if (!changed && zonePixelsValid && zoneMapVersion == getLEDMapVersion()) return;
+
+  const LightZones::Region *regions[LightZones::MAX_ZONES];
+  for (uint8_t z = 0; z < zoneCount; z++) {
+    regions[z] = &zones[z].region;
+    zoneCache[z].still = zoneIsStill(zones[z]);
+    zoneCache[z].valid = false;
+  }
+  LightZones::buildPixelLists(regions, zoneCount, getLEDMapX(), getLEDMapY(), zonePixels);
+  LightNoise::invalidate(noiseField);
+  zoneMapVersion = getLEDMapVersion();
+  zonePixelsValid = true;
+}
+
+// Phase 0..255 of a cycle at atMs: zones follow the frame time instead of phase timers
+static uint8_t zonePhase(uint32_t atMs, uint8_t cycleSec) {
+  const uint32_t periodMs = cycleOrDefault(cycleSec) * 1000UL;
+  return static_cast<uint8_t>(((atMs % periodMs) * 256UL) / periodMs);
+}
+
+// Ring renderer for one zone: the look of renderLeds(), with the gradient entry and the
+// distance computed per pixel (a zone has no gradient table or distance cache of its own).
+// The zone's brightness scales its range; 0 renders black.
+static void renderZone(const LightZone &z, PhaseTable &radiusTable, const uint16_t *pixels, uint16_t count,
+                       uint32_t atMs, uint8_t maxBrightness, CRGB *out, LightPower::Sums &sums) {
+  const LightShowParams &p = z.show;
+  float animRadius, centerX, centerY;
+  ringPose(p, radiusTable, zonePhase(atMs, p.brightCycleSec), zonePhase(atMs, p.xCycleSec),
+           zonePhase(atMs, p.yCycleSec), animRadius, centerX, centerY);
+  const uint8_t windowStart = zonePhase(atMs, p.colorCycleSec);
+  const int windowWidth = p.windowWidth > 0 ? p.windowWidth : 16;
+  const float invFadeWidth = 1.0f / p.fadeWidth;
+  const uint8_t minB = scale8(p.minBrightness, z.brightness);
+  const uint8_t ceiling = scale8(maxBrightness, z.brightness);
+  const float range = ceiling > minB ? ceiling - minB : 0.0f;
+  const float *xs = getLEDMapX();
+  const float *ys = getLEDMapY();
+
+  for (uint16_t n = 0; n < count; ++n) {
+    const uint16_t i = pixels[n];
+    const float dx = xs[i] - centerX;
+    const float dy = ys[i] - centerY;
+    const float blend = MathUtils::clamp(fabsf(sqrtf(dx * dx + dy * dy) - animRadius) * invFadeWidth, 0.0f, 1.0f);
+    const float fade = (1.0f - blend) * (1.0f - blend);
+
+    const CRGB g = gradientColor(p.RGB1, p.RGB2, (windowStart + int(blend * (windowWidth - 1))) & (GRADIENT_SIZE - 1),
+                                 GRADIENT_SIZE);
+    CRGB color(colorLut[0][g.r], colorLut[1][g.g], colorLut[2][g.b]);
+    const uint8_t brightness = minB + static_cast<uint8_t>(fade * range);
+    if (brightness > 0) color.nscale8_video(brightness);
+    else                color = CRGB::Black;
+
+    out[i] = color;
+    sums.add(color);
+  }
+}
+
+static void renderZones(uint32_t atMs, uint8_t maxBrightness) {
+  for (uint8_t z = 0; z < zoneCount; z++) {
+    const uint16_t *pixels = zonePixels.pixels + zonePixels.start[z + 1];
+    const uint16_t count = zonePixels.start[z + 2] - zonePixels.start[z + 1];
+    if (count == 0) continue;
+    ZoneCache &c = zoneCache[z];
+    if (!c.still) {
+      renderZone(zones[z], c.radiusTable, pixels, count, atMs, maxBrightness, frame, frameSums);
+      continue;
+    }
+    if (!c.valid || c.maxBrightness != maxBrightness || c.lutSeq != lutSeq) {
+      c.sums = LightPower::Sums();
+      renderZone(zones[z], c.radiusTable, pixels, count, atMs, maxBrightness, stillFrame, c.sums);
+      c.maxBrightness = maxBrightness;
+      c.lutSeq = lutSeq;
+      c.valid = true;
+    }
+    for (uint16_t n = 0; n < count; ++n) {
+      frame[pixels[n]] = stillFrame[pixels[n]];
+    }
+    frameSums.add(c.sums);
+  }
+}
+
+// === Frame ===
+// Per-LED work and output; runs on the loop core or in the render task
+static void renderFrame(const RenderFrame &f) {
+  const uint32_t startUs = micros();
+  const LightShowParams &p = f.params;
+
+  float animRadius, centerX, centerY;
+  ringPose(p, showRadiusTable, f.brightPhase, f.xPhase, f.yPhase, animRadius, centerX, centerY);
+
+  updateGradient(p, f.morphSeq, f.morph);
+  // Decoded every frame while streaming, so the show keeps its time during a morph into it
+  const uint8_t *baked = f.bakedActive ? BakedShow::advance(f.bakedFrame) : nullptr;
+
+  // Sliding window over the color gradient: windowStart scrolls through,
+  // windowWidth determines how many gradient colors are visible at once
+  int windowWidth = p.windowWidth > 0 ? p.windowWidth : 16;
+
+  updateGeometry(centerX, centerY);
+  updateZones();
+  // Main show over the LEDs outside every zone (all of them without zones)
+  const uint16_t *pixels = zonePixels.pixels;
+  const uint16_t count = zonePixels.start[1];
+  frameSums = LightPower::Sums();
+  if (p.baked && f.bakedActive) {
+    renderBaked(pixels, count, baked, f.maxBrightness);
+  } else if (const LightVM::Program *prog = LightVM::get(p.program)) {
+    renderProgram(pixels, count, *prog, f, animRadius, f.maxBrightness);
+  } else if (p.noiseSize > 0.0f) {
+    renderNoise(pixels, count, p, f.atMs, centerX, centerY, f.colorPhase, windowWidth, f.maxBrightness);
+  } else {
+    renderLeds(pixels, count, p, animRadius, f.colorPhase, windowWidth, f.maxBrightness);
+  }
+  renderZones(f.atMs, f.maxBrightness);
+  LightCompositor::compose(frame, NUM_LEDS, &frameSums);
+
+  showFrame(f.brightness);
+
+  const uint32_t renderUs = micros() - startUs;
+  renderUsAvg += (static_cast<int32_t>(renderUs - renderUsAvg)) / 16;
+  if (renderUs > renderUsMax) renderUsMax = renderUs;
+}
+
+// === Morph ===
+// A pattern or color change glides over Globals::lightMorphMs instead of jumping:
+// the numeric params are interpolated here, the old and new gradient crossfade in
+// updateGradient(). Still one render pass per frame. A change of light program
+// or baked show cannot be interpolated and switches halfway; so does a change
+// to or from the noise renderer (noise to noise glides).
+static LightShowParams morphFrom;  // What was shown when the morph started
+static uint32_t morphStartMs = 0;
+static uint16_t morphMs = 0;       // 0 = no morph running
+static uint16_t morphSeq = 0;
+static bool showPlayed = false;
+
+// Eased progress 0..255 of the running morph; ends it when the time is up
+static uint8_t advanceMorph() {
+  if (morphMs == 0) return 255;
+  const uint32_t elapsed = timers.now() - morphStartMs;
+  if (elapsed >= morphMs) {
+    morphMs = 0;
+    return 255;
+  }
+  const float t = static_cast<float>(elapsed) / morphMs;
+  return static_cast<uint8_t>(t * t * (3.0f - 2.0f * t) * 255.0f);
+}
+
+static LightShowParams morphedParams(uint8_t morph) {
+  if (morph == 255) return showParams;
+  const LightShowParams &a = morphFrom;
+  LightShowParams p = showParams;  // Colors and cycle times: the target's
+  const float k = morph / 255.0f;
+  auto mix = [k](float from, float to) { return from + (to - from) * k; };
+  p.fadeWidth     = mix(a.fadeWidth, p.fadeWidth);
+  p.gradientSpeed = mix(a.gradientSpeed, p.gradientSpeed);
+  p.centerX       = mix(a.centerX, p.centerX);
+  p.centerY       = mix(a.centerY, p.centerY);
+  p.radius        = mix(a.radius, p.radius);
+  p.radiusOsc     = mix(a.radiusOsc, p.radiusOsc);
+  p.xAmp          = mix(a.xAmp, p.xAmp);
+  p.yAmp          = mix(a.yAmp, p.yAmp);
+  p.windowWidth   = static_cast<int>(lroundf(mix(static_cast<float>(a.windowWidth), static_cast<float>(p.windowWidth))));
+  p.minBrightness = lerp8by8(a.minBrightness, p.minBrightness, morph);
+  if (a.noiseSize > 0.0f && p.noiseSize > 0.0f) {
+    p.noiseSize  = mix(a.noiseSize, p.noiseSize);
+    p.noiseSpeed = mix(a.noiseSpeed, p.noiseSpeed);
+  } else if (morph < 128) {
+    p.noiseSize  = a.noiseSize;
+    p.noiseSpeed = a.noiseSpeed;
+    p.noiseFps   = a.noiseFps;
+  }
+  if (morph < 128) {
+    p.program = a.program;
+    p.baked = a.baked;
+  }
+  return p;
+}
+
+static bool sameShow(const LightShowParams &a, const LightShowParams &b) {
+  return a.RGB1 == b.RGB1 && a.RGB2 == b.RGB2 && a.colorCycleSec == b.colorCycleSec &&
+         a.brightCycleSec == b.brightCycleSec && a.minBrightness == b.minBrightness &&
+         a.xCycleSec == b.xCycleSec && a.yCycleSec == b.yCycleSec && a.fadeWidth == b.fadeWidth &&
+         a.gradientSpeed == b.gradientSpeed && a.centerX == b.centerX && a.centerY == b.centerY &&
+         a.radius == b.radius && a.radiusOsc == b.radiusOsc && a.xAmp == b.xAmp && a.yAmp == b.yAmp &&
+         a.windowWidth == b.windowWidth && a.program == b.program && a.baked == b.baked &&
+         a.noiseSize == b.noiseSize && a.noiseSpeed == b.noiseSpeed && a.noiseFps == b.noiseFps;
+}
+
+bool isLightMorphing() {
+  return morphMs != 0;
+}
+
+static RenderFrame currentFrame() {
+  RenderFrame f;
+  f.morph = advanceMorph();
+  f.morphSeq = morphSeq;
+  f.params = morphedParams(f.morph);
+  f.colorPhase = colorPhase;
+  f.brightPhase = brightPhase;
+  f.xPhase = xPhase;
+  f.yPhase = yPhase;
+  f.brightness = outputBrightness;
+  f.maxBrightness = getBrightnessBaseHi();
+  f.audio = isAudioBusy() ? MathUtils::clamp01(getAudioLevelRaw() / 32768.0f) : 0.0f;
+  f.bands = isAudioBusy() ? getAudioBands() : AudioBands{};
+  f.bakedActive = BakedShow::activeId() != 0;
+  f.bakedFrame = f.bakedActive ? BakedShow::frameIndex() : 0;
+  f.atMs = timers.now();
+  return f;
+}
+
+#if LIGHT_RENDER_TASK
+// === Render task ===
+// Owns frame[], leds[] and FastLED output. The loop core publishes frames and notifies;
+// the task always renders the latest one (older pending frames are dropped).
+static Seqlock<RenderFrame> frameSlot;
+static TaskHandle_t renderTask = nullptr;
+
+static void renderTaskMain(void *) {
+  RenderFrame f;
+  for (;;) {
+    // Between frames, wake at the dither rate while the output has a fraction
+    const uint16_t refreshMs = outputFraction ? ditherRefreshMs() : 0;
+    if (!ulTaskNotifyTake(pdTRUE, refreshMs ? pdMS_TO_TICKS(refreshMs) : portMAX_DELAY)) {
+      refreshDither(timers.now());
+      continue;
+    }
+    frameSlot.read(f);
+    renderFrame(f);
+  }
+}
+
+static void submitFrame() {
+  frameSlot.write(currentFrame());
+  if (renderTask) xTaskNotifyGive(renderTask);
+}
+
+void startRenderTask() {
+  if (renderTask) return;
+  // Pin to the core loop() does not run on
+  const BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+  xTaskCreatePinnedToCore(renderTaskMain, "render", 4096, nullptr, 2, &renderTask, core);
+}
+#else
+static void submitFrame() {
+  renderFrame(currentFrame());
+}
+
+void startRenderTask() {}
+#endif
+
+// === Update ===
+// SD reads PlayLightShow leaves to the loop core (it may run in a web handler): the show's
+// light program, read once per id, and the start of its baked show (file open and header,
+// like fill()'s chunk reads). Until then the ring renderer stands in; then the frame rate is
+// planned again for the program's inputs or the file's fps.
+static void loadShowAssets() {
+  const LightShowParams &p = showParams;
+  bool loaded = false;
+  if (p.program && !LightVM::get(p.program)) loaded = LightVM::load(p.program);
+  if (p.baked && p.baked != BakedShow::activeId()) loaded = BakedShow::start(p.baked) || loaded;
+  if (loaded) planFrameRate(cycleOrDefault(p.colorCycleSec), cycleOrDefault(p.brightCycleSec));
+}
+
+void updateLightController() {
+  applyBrightness();
+  loadShowAssets();
+  if (!showParams.baked && !morphMs) BakedShow::stop();  // Morph away from a baked show is done
+  BakedShow::fill(isAudioBusy());  // SD reads stay on the loop core, next to the MP3 stream
+  submitFrame();
+
+  frameIntervalMs = showFrameMs;
+  if (isAudioBusy() && Globals::lightAudioFps > 0) {
+    frameIntervalMs = min<uint16_t>(frameIntervalMs, 1000U / Globals::lightAudioFps);
+  }
+  if (morphMs) {
+    frameIntervalMs = min<uint16_t>(frameIntervalMs, 1000U / max<uint8_t>(Globals::lightFpsMax, 1));
+  }
+}
+
+void showBrightness(uint8_t brightness) {
+  outputBrightness = brightness;
+#if LIGHT_RENDER_TASK
+  submitFrame();
+#else
+  showFrame(brightness);  // Current frame at the new brightness
+#endif
 }
 
 LightShowParams MakeSolidParams(CRGB color) {
@@ -163,22 +1068,45 @@ LightShowParams MakeSolidParams(CRGB color) {
 }
 
 void PlayLightShow(const LightShowParams &p) {
+  if (showPlayed && Globals::lightMorphMs > 0 && !sameShow(p, showParams)) {
+    morphFrom = morphedParams(advanceMorph());  // Mid-morph: continue from what is shown
+    morphStartMs = timers.now();
+    morphMs = Globals::lightMorphMs;
+    morphSeq++;
+  }
   showParams = p;
-  uint8_t ccs = p.colorCycleSec  > 0 ? p.colorCycleSec  : 10;
-  uint8_t bcs = p.brightCycleSec > 0 ? p.brightCycleSec : 10;
-  xCycleSec = p.xCycleSec > 0 ? p.xCycleSec : 10;
-  yCycleSec = p.yCycleSec > 0 ? p.yCycleSec : 10;
+  showPlayed = true;
+  uint8_t ccs = cycleOrDefault(p.colorCycleSec);
+  uint8_t bcs = cycleOrDefault(p.brightCycleSec);
+  xCycleSec = cycleOrDefault(p.xCycleSec);
+  yCycleSec = cycleOrDefault(p.yCycleSec);
+
+  restartPhaseTimer(colorCycleTimer, (ccs * 1000UL) / 255UL, cb_colorCycle);
+  restartPhaseTimer(brightCycleTimer, (bcs * 1000UL) / 255UL, cb_brightCycle);
+  restartPhaseTimer(xPhaseTimer, (xCycleSec * 1000UL) / 255UL, cb_xPhase);
+  restartPhaseTimer(yPhaseTimer, (yCycleSec * 1000UL) / 255UL, cb_yPhase);
+
+  planFrameRate(ccs, bcs);
+}
+
+void setLightZones(const LightZone *zoneList, uint8_t count) {
+  if (count > LightZones::MAX_ZONES) count = LightZones::MAX_ZONES;
+  ZONE_LOCK();
+  for (uint8_t z = 0; z < count; z++) pendingZones[z] = zoneList[z];
+  pendingZoneCount = count;
+  zoneSeq++;
+  ZONE_UNLOCK();
+  planFrameRate(cycleOrDefault(showParams.colorCycleSec), cycleOrDefault(showParams.brightCycleSec));
+}
 
-  timers.restart((ccs * 1000UL) / 255UL, 0, cb_colorCycle);
-  timers.restart((bcs * 1000UL) / 255UL, 0, cb_brightCycle);
-  timers.restart((xCycleSec * 1000UL) / 255UL, 0, cb_xPhase);
-  timers.restart((yCycleSec * 1000UL) / 255UL, 0, cb_yPhase);
+uint8_t getLightZoneCount() {
+  return pendingZoneCount;
 }
 
 // === Brightness ===
 void applyBrightness() {
-  // Skip while fade callbacks own FastLED brightness (lux measurement cycle)
-  if (Globals::brightnessFading) return;
+  // Skip while a lux measurement blanks the LEDs (LightRun)
+  if (Globals::luxBlanking) return;
 
   // sliderPct is derived from shiftedHi, which already includes webMultiplier
   int sliderPct = getSliderPct();
@@ -196,26 +1124,23 @@ void applyBrightness() {
     }
   }
 
-  FastLED.setBrightness(brightness);
+  outputBrightness = brightness;
 }
 
 // === RGB/Helpers ===
 void generateColorGradient(const CRGB &colorA, const CRGB &colorB, CRGB *grad, int n) {
   for (int i = 0; i < n; ++i) {
-    float t = (float)i / (float)(n - 1);
-    uint8_t blend;
-    if (t < 0.5f) {
-      blend = (uint8_t)(t * 2.0f * 255.0f);
-      grad[i] = CRGB(
-        lerp8by8(colorA.r, colorB.r, blend),
-        lerp8by8(colorA.g, colorB.g, blend),
-        lerp8by8(colorA.b, colorB.b, blend));
-    } else {
-      blend = (uint8_t)((1.0f - (t - 0.5f) * 2.0f) * 255.0f);
-      grad[i] = CRGB(
-        lerp8by8(colorA.r, colorB.r, blend),
-        lerp8by8(colorA.g, colorB.g, blend),
-        lerp8by8(colorA.b, colorB.b, blend));
+    grad[i] = gradientColor(colorA, colorB, i, n);
+  }
+}
+
+void buildColorLut(uint8_t lut[3][256], float gamma, const uint8_t white[3]) {
+  for (uint8_t c = 0; c < 3; ++c) {
+    for (int i = 0; i < 256; ++i) {
+      const float v = powf(i / 255.0f, gamma) * white[c];
+      uint8_t out = static_cast<uint8_t>(v + 0.5f);
+      if (out == 0 && i > 0 && white[c] > 0) out = 1;  // A lit channel stays lit (like nscale8_video)
+      lut[c][i] = out;
     }
   }
 }
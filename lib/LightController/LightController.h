@@ -1,14 +1,15 @@
 /**
  * @file LightController.h
  * @brief LED control interface via FastLED library
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #pragma once
 
 #include <FastLED.h>
 #include "Globals.h"
 #include "LEDMap.h"
+#include "LightZones.h"
 #include "TimerManager.h"
 
 class LightController {
@@ -30,6 +31,11 @@ struct LightShowParams {
   uint8_t colorCycleSec, brightCycleSec, minBrightness, xCycleSec, yCycleSec;
   float fadeWidth, gradientSpeed, centerX, centerY, radius, radiusOsc, xAmp, yAmp;
   int   windowWidth;
+  uint8_t program = 0;  // Light program id (/light_programs/<id>.lpb), 0 = ring renderer
+  uint8_t baked = 0;    // Baked show id (/light_shows/<id>.lsb), 0 = rendered live
+  float noiseSize = 0.0f;   // Noise renderer: map units per noise cell, 0 = ring renderer
+  float noiseSpeed = 0.0f;  // Noise cells per second along the time axis
+  uint8_t noiseFps = 0;     // Noise field update rate (interpolated in between), 0 = every frame
 
    LightShowParams() = default;
 
@@ -68,6 +74,16 @@ struct LightShowParams {
     uint8_t yCycleSec = 10;
 };
 */
+
+// A region of the LED map with a show of its own. Zones use the ring renderer (program,
+// baked and noise are ignored) and do not morph. brightness scales the show's brightness range
+// (255 = as the main show, 0 = off).
+struct LightZone {
+  LightZones::Region region;
+  LightShowParams show;
+  uint8_t brightness = 255;
+};
+
 #define GRADIENT_SIZE 256
 extern CRGB leds[];
 
@@ -84,12 +100,41 @@ uint8_t getBrightnessBaseHi();
 void setBrightnessBaseHi(uint8_t value);
 
 void updateLightController();
+// Show the current frame at this brightness (lux blanking); goes through the render task when enabled
+void showBrightness(uint8_t brightness);
+// Start the render task on the other core (LIGHT_RENDER_TASK builds; no-op otherwise)
+void startRenderTask();
+// Render statistics: frames sent to the strip vs. skipped as unchanged
+uint32_t getFramesShown();
+uint32_t getFramesSkipped();
+// Outputs between frames that only advanced temporal dithering (Globals::lightDitherMinFps)
+uint32_t getFramesDithered();
+// Last frame sent to the strip, before global brightness, and that brightness (after the power cap).
+// Written by the render task in LIGHT_RENDER_TASK builds: diagnostics and host tests only.
+const CRGB *getShownFrame();
+uint8_t getShownBrightness();
+// Frame rate governor: repaint interval wanted after the last frame, render cost
+uint16_t getFrameIntervalMs();
+uint32_t getRenderUsAvg();
+uint32_t getRenderUsMax();
+// Power estimate of the last shown frame (FastLED model) and the brightness cap keeping it in budget
+uint32_t getLedMilliwatts();
+uint8_t getLedPowerCap();
+// Start a show; after the first one, changes morph over Globals::lightMorphMs
 void PlayLightShow(const LightShowParams&);
+// True while a pattern/color change is still morphing
+bool isLightMorphing();
 LightShowParams MakeSolidParams(CRGB color);
+// Replace the zones (up to LightZones::MAX_ZONES); LEDs outside every zone keep the main show
+void setLightZones(const LightZone *zones, uint8_t count);
+uint8_t getLightZoneCount();
 
 // Timer callbacks (used by LightBoot)
 void cb_colorCycle();
 void cb_brightCycle();
 
+// Compute frame brightness (slider, audio modulation); skipped while a lux measurement blanks the LEDs
 void applyBrightness();
 void generateColorGradient(const CRGB& colorA, const CRGB& colorB, CRGB* gradient, int n = GRADIENT_SIZE);
+// Per-channel color correction: lut[c][v] = round((v/255)^gamma * white[c]), lit inputs stay >= 1
+void buildColorLut(uint8_t lut[3][256], float gamma, const uint8_t white[3]);
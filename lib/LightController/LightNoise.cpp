@@ -0,0 +1,101 @@
+/**
+ * @file LightNoise.cpp
+ * @brief Coherent noise field: cached coordinates, keyframes and interpolation
+ * @version 261016W
+ * @date 2026-10-16
+ */
+#include "LightNoise.h"
+
+#include <FastLED.h>
+#include <math.h>
+#include <string.h>
+#include "LEDMap.h"
+
+namespace LightNoise {
+
+namespace {
+
+void rebuildCoords(Field &f, float cellSize) {
+    const float *xs = getLEDMapX();
+    const float *ys = getLEDMapY();
+    const float k = 65536.0f / cellSize;
+    for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        f.x[i] = static_cast<int32_t>(lroundf(xs[i] * k));
+        f.y[i] = static_cast<int32_t>(lroundf(ys[i] * k));
+    }
+    f.cellSize = cellSize;
+    f.mapVersion = getLEDMapVersion();
+}
+
+// Time axis aheadMs from the last advance, 16.16 cells. Wrapping to 32 bits is seamless:
+// the noise lattice repeats every 256 cells.
+uint32_t zAt(const Field &f, int32_t speedQ16, int32_t aheadMs) {
+    const int64_t milli = f.zMilli + static_cast<int64_t>(speedQ16) * aheadMs;
+    return static_cast<uint32_t>((milli >= 0 ? milli : milli - 999) / 1000);
+}
+
+void fill(Field &f, const uint16_t *pixels, uint16_t count, uint32_t offX, uint32_t offY, uint32_t z,
+          uint16_t *out) {
+    for (uint16_t n = 0; n < count; n++) {
+        const uint16_t i = pixels[n];
+        out[i] = inoise16(static_cast<uint32_t>(f.x[i]) + offX, static_cast<uint32_t>(f.y[i]) + offY, z);
+    }
+    f.samples += count;
+}
+
+} // namespace
+
+void sample(Field &f, const uint16_t *pixels, uint16_t count, const Pose &pose, uint16_t *out) {
+    const bool rebuild = pose.cellSize != f.cellSize || f.mapVersion != getLEDMapVersion();
+    if (rebuild) rebuildCoords(f, pose.cellSize);
+
+    // Integrated, so a speed change (morph) does not jump along the time axis
+    const int32_t speedQ16 = static_cast<int32_t>(lroundf(pose.speed * 65536.0f));
+    if (!f.zStarted) {
+        f.zAtMs = pose.atMs;
+        f.zStarted = true;
+    }
+    f.zMilli += static_cast<int64_t>(speedQ16) * static_cast<int32_t>(pose.atMs - f.zAtMs);
+    f.zAtMs = pose.atMs;
+
+    const float k = 65536.0f / pose.cellSize;
+    const uint32_t offX = static_cast<uint32_t>(static_cast<int32_t>(lroundf(-pose.centerX * k)));
+    const uint32_t offY = static_cast<uint32_t>(static_cast<int32_t>(lroundf(-pose.centerY * k)));
+
+    // Sampled directly at fps 0, and while the cell size glides (morph): keyframes would be stale
+    if (pose.fps == 0 || rebuild) {
+        fill(f, pixels, count, offX, offY, zAt(f, speedQ16, 0), out);
+        f.keysValid = false;
+        return;
+    }
+
+    // Keyframes at the start and end of the period holding atMs; the next period reuses the end one
+    const uint32_t periodMs = 1000U / pose.fps;
+    const uint32_t keyMs = pose.atMs - pose.atMs % periodMs;
+    const int32_t sinceKey = static_cast<int32_t>(pose.atMs - keyMs);
+    const bool samePeriod = f.keysValid && f.keyPeriodMs == periodMs;
+    if (!samePeriod || keyMs != f.keyMs) {
+        if (samePeriod && keyMs == f.keyMs + periodMs) {
+            memcpy(f.key[0], f.key[1], sizeof(f.key[0]));
+        } else {
+            fill(f, pixels, count, offX, offY, zAt(f, speedQ16, -sinceKey), f.key[0]);
+        }
+        fill(f, pixels, count, offX, offY, zAt(f, speedQ16, static_cast<int32_t>(periodMs) - sinceKey), f.key[1]);
+        f.keyMs = keyMs;
+        f.keyPeriodMs = periodMs;
+        f.keysValid = true;
+    }
+
+    const int32_t frac = static_cast<int32_t>((static_cast<uint32_t>(sinceKey) << 15) / periodMs);  // Q0.15
+    for (uint16_t n = 0; n < count; n++) {
+        const uint16_t i = pixels[n];
+        const int32_t a = f.key[0][i];
+        out[i] = static_cast<uint16_t>(a + (((f.key[1][i] - a) * frac) >> 15));
+    }
+}
+
+void invalidate(Field &f) {
+    f.keysValid = false;
+}
+
+} // namespace LightNoise
@@ -0,0 +1,50 @@
+/**
+ * @file LightNoise.h
+ * @brief Coherent noise field (FastLED inoise16) over the LED map for the noise renderer
+ * @version 261016W
+ * @date 2026-10-16
+ *
+ * A noise pattern samples 3D Perlin noise at each LED's map position, with
+ * time as the third axis. The LED map scaled to noise cells is cached in
+ * 16.16 fixed point and only rebuilt when the cell size or the map changes;
+ * a frame adds the drifting center as one offset. With fps > 0 the field is
+ * sampled at that rate only, into two keyframes around the frame time, and
+ * frames in between interpolate them: one inoise16 per LED per keyframe
+ * instead of per frame.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "HWconfig.h"  // for NUM_LEDS
+
+namespace LightNoise {
+
+// Where and when to sample
+struct Pose {
+    float cellSize;           // Map units per noise cell (> 0)
+    float speed;              // Cells per second along the time axis
+    float centerX, centerY;   // Field origin on the map (moves the field with the show center)
+    uint8_t fps;              // Field update rate, 0 = every frame
+    uint32_t atMs;            // Frame time
+};
+
+struct Field {
+    int32_t x[NUM_LEDS], y[NUM_LEDS];  // LED map in noise cells, 16.16
+    float cellSize = 0.0f;
+    uint16_t mapVersion = 0;
+    int64_t zMilli = 0;                // Time axis in 16.16 cells x 1000, integrated per frame
+    uint32_t zAtMs = 0;
+    bool zStarted = false;
+    uint16_t key[2][NUM_LEDS];         // Keyframes at keyMs and keyMs + period, by LED index
+    uint32_t keyMs = 0, keyPeriodMs = 0;
+    bool keysValid = false;
+    uint32_t samples = 0;              // inoise16 calls so far (benchmark)
+};
+
+// Field value 0..65535 of each listed LED, written to out[index]. Rebuilds the cached
+// coordinates when the cell size or the LED map changed.
+void sample(Field &field, const uint16_t *pixels, uint16_t count, const Pose &pose, uint16_t *out);
+// Drop the keyframes (the pixel lists changed: LEDs not sampled so far may be listed now)
+void invalidate(Field &field);
+
+} // namespace LightNoise
@@ -0,0 +1,35 @@
+/**
+ * @file LightPower.cpp
+ * @brief LED power estimate from per-channel sums
+ * @version 261016Q
+ * @date 2026-10-16
+ */
+#include "LightPower.h"
+
+namespace LightPower {
+
+namespace {
+
+uint32_t colorMilliwatts(const Sums &sums) {
+    return ((sums.r * RED_MW) >> 8) + ((sums.g * GREEN_MW) >> 8) + ((sums.b * BLUE_MW) >> 8);
+}
+
+} // namespace
+
+uint32_t unscaledMilliwatts(const Sums &sums, uint16_t count) {
+    return colorMilliwatts(sums) + static_cast<uint32_t>(DARK_MW) * count;
+}
+
+uint32_t milliwatts(const Sums &sums, uint16_t count, uint8_t brightness) {
+    return (colorMilliwatts(sums) * brightness) / 256 + static_cast<uint32_t>(DARK_MW) * count;
+}
+
+uint8_t maxBrightness(const Sums &sums, uint16_t count, uint8_t target, uint32_t maxMilliwatts) {
+    if (milliwatts(sums, count, target) <= maxMilliwatts) return target;
+    const uint32_t dark = static_cast<uint32_t>(DARK_MW) * count;
+    if (maxMilliwatts <= dark) return 0;
+    // Color draw scales linearly with brightness: solve for the budget left after the idle draw
+    return static_cast<uint8_t>(((maxMilliwatts - dark) * 256) / colorMilliwatts(sums));
+}
+
+} // namespace LightPower
@@ -0,0 +1,42 @@
+/**
+ * @file LightPower.h
+ * @brief LED power estimate from per-channel sums (replaces FastLED's power limiter)
+ * @version 261016V
+ * @date 2026-10-16
+ *
+ * The renderers add every pixel they write to a Sums; the compositor corrects
+ * the pixels it blends. Power at a global brightness then follows from three
+ * sums, without the extra pass over the strip FastLED's limiter makes in
+ * every show(). The model is FastLED's (calculate_unscaled_power_mW); unlike
+ * its limiter, the idle draw of dark LEDs is not scaled with brightness.
+ */
+#pragma once
+
+#include <FastLED.h>
+#include <stdint.h>
+
+namespace LightPower {
+
+// FastLED's per-channel model at full output: mA x 5 V
+constexpr uint8_t RED_MW = 16 * 5;
+constexpr uint8_t GREEN_MW = 11 * 5;
+constexpr uint8_t BLUE_MW = 15 * 5;
+constexpr uint8_t DARK_MW = 1 * 5;
+constexpr uint8_t MODEL_VOLTS = 5;
+
+struct Sums {
+    uint32_t r = 0, g = 0, b = 0;
+
+    void add(const CRGB &c) { r += c.r; g += c.g; b += c.b; }
+    void add(const Sums &s) { r += s.r; g += s.g; b += s.b; }
+    void sub(const CRGB &c) { r -= c.r; g -= c.g; b -= c.b; }
+};
+
+// Draw of count LEDs at brightness 255
+uint32_t unscaledMilliwatts(const Sums &sums, uint16_t count);
+// Draw at a global brightness: color channels scaled, idle draw not
+uint32_t milliwatts(const Sums &sums, uint16_t count, uint8_t brightness);
+// Highest brightness <= target that stays within maxMilliwatts
+uint8_t maxBrightness(const Sums &sums, uint16_t count, uint8_t target, uint32_t maxMilliwatts);
+
+} // namespace LightPower
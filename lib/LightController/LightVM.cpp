@@ -0,0 +1,241 @@
+/**
+ * @file LightVM.cpp
+ * @brief Bytecode interpreter for user-defined light shows (light programs)
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#include "LightVM.h"
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <math.h>
+#include <string.h>
+#include "Globals.h"
+#include "HWconfig.h"  // NUM_LEDS
+#include "SDController.h"
+
+namespace LightVM {
+
+namespace {
+
+enum SlotState : uint8_t { SLOT_EMPTY, SLOT_READY, SLOT_REFUSED };
+
+Program programs[PROGRAM_SLOTS];
+SlotState slotState[PROGRAM_SLOTS];
+
+// Operand bytes and stack effect per opcode; pops < 0 marks an unknown opcode
+struct OpInfo {
+    int8_t pops;
+    int8_t pushes;
+    uint8_t operandBytes;
+};
+
+OpInfo opInfo(uint8_t op) {
+    switch (op) {
+        case OP_PUSH:   return {0, 1, 4};
+        case OP_IN:     return {0, 1, 1};
+        case OP_LOAD:   return {0, 1, 1};
+        case OP_STORE:  return {1, 0, 1};
+        case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV: case OP_MOD:
+        case OP_MIN: case OP_MAX: case OP_LT: case OP_GT:
+                        return {2, 1, 0};
+        case OP_NEG: case OP_ABS: case OP_SIN: case OP_COS: case OP_FRACT:
+        case OP_FLOOR: case OP_SQRT: case OP_CLAMP:
+                        return {1, 1, 0};
+        case OP_SELECT: case OP_MIX:
+                        return {3, 1, 0};
+        case OP_INDEX: case OP_BRIGHT:
+                        return {1, 0, 0};
+        default:        return {-1, 0, 0};
+    }
+}
+
+// Inf and NaN (x / tiny, sqrt of a huge product) become 0: a float-to-int cast of either is undefined
+inline float finiteOrZero(float v) {
+    return isfinite(v) ? v : 0.0f;
+}
+
+// sin16 keeps host renders and the device bit-identical
+inline float turnSin(float turns, float offset = 0.0f) {
+    turns = finiteOrZero(turns) + offset;
+    const uint32_t angle = static_cast<uint32_t>((turns - floorf(turns)) * 65536.0f);
+    return sin16(static_cast<uint16_t>(angle)) / 32768.0f;
+}
+
+} // namespace
+
+bool parse(const uint8_t *data, size_t size, Program &out) {
+    if (size < sizeof(MAGIC) + 1 || memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        PF("[LightVM] Not a light program\n");
+        return false;
+    }
+    const size_t length = data[sizeof(MAGIC)];
+    const uint8_t *code = data + sizeof(MAGIC) + 1;
+    if (length == 0 || size < sizeof(MAGIC) + 1 + length) {
+        PF("[LightVM] Truncated program\n");
+        return false;
+    }
+
+    int depth = 0;
+    uint16_t ops = 0;
+    uint16_t inputMask = 0;
+    for (size_t pc = 0; pc < length; ops++) {
+        const uint8_t op = code[pc];
+        const OpInfo info = opInfo(op);
+        if (info.pops < 0) {
+            PF("[LightVM] Unknown opcode 0x%02X at %u\n", op, static_cast<unsigned>(pc));
+            return false;
+        }
+        if (pc + 1 + info.operandBytes > length) {
+            PF("[LightVM] Operand past end at %u\n", static_cast<unsigned>(pc));
+            return false;
+        }
+        const uint8_t operand = info.operandBytes ? code[pc + 1] : 0;
+        if (op == OP_IN) {
+            if (operand >= IN_COUNT) {
+                PF("[LightVM] Unknown input %u at %u\n", operand, static_cast<unsigned>(pc));
+                return false;
+            }
+            inputMask |= 1U << operand;
+        }
+        if ((op == OP_LOAD || op == OP_STORE) && operand >= VAR_COUNT) {
+            PF("[LightVM] Unknown variable %u at %u\n", operand, static_cast<unsigned>(pc));
+            return false;
+        }
+        depth -= info.pops;
+        if (depth < 0) {
+            PF("[LightVM] Stack underflow at %u\n", static_cast<unsigned>(pc));
+            return false;
+        }
+        depth += info.pushes;
+        if (depth > STACK_MAX) {
+            PF("[LightVM] Stack deeper than %u at %u\n", STACK_MAX, static_cast<unsigned>(pc));
+            return false;
+        }
+        pc += 1 + info.operandBytes;
+    }
+
+    const uint32_t perFrame = static_cast<uint32_t>(ops) * NUM_LEDS;
+    if (perFrame > Globals::lightProgramBudget) {
+        PF("[LightVM] %u instructions per frame over budget %u\n",
+           static_cast<unsigned>(perFrame), Globals::lightProgramBudget);
+        return false;
+    }
+
+    memcpy(out.code, code, length);
+    out.length = static_cast<uint8_t>(length);
+    out.ops = static_cast<uint8_t>(ops);
+    out.inputMask = inputMask;
+    return true;
+}
+
+bool load(uint8_t id) {
+    if (id == 0 || id >= PROGRAM_SLOTS) {
+        return false;
+    }
+    if (slotState[id] != SLOT_EMPTY) {
+        return slotState[id] == SLOT_READY;
+    }
+
+    char path[32];
+    snprintf(path, sizeof(path), "/light_programs/%u.lpb", id);
+    slotState[id] = SLOT_REFUSED;
+    if (!SDController::fileExists(path)) {
+        PF("[LightVM] %s not found\n", path);
+        return false;
+    }
+    File file = SDController::openFileRead(path);
+    if (!file) {
+        return false;
+    }
+    uint8_t data[sizeof(MAGIC) + 1 + CODE_MAX];
+    const size_t size = file.read(data, sizeof(data));
+    SDController::closeFile(file);
+
+    if (!parse(data, size, programs[id])) {
+        PF("[LightVM] %s refused\n", path);
+        return false;
+    }
+    slotState[id] = SLOT_READY;
+    PF("[LightVM] %s: %u instructions per LED\n", path, programs[id].ops);
+    return true;
+}
+
+void forgetRefused() {
+    for (uint8_t id = 0; id < PROGRAM_SLOTS; id++) {
+        if (slotState[id] == SLOT_REFUSED) slotState[id] = SLOT_EMPTY;
+    }
+}
+
+const Program *get(uint8_t id) {
+    if (id == 0 || id >= PROGRAM_SLOTS || slotState[id] != SLOT_READY) {
+        return nullptr;
+    }
+    return &programs[id];
+}
+
+Result run(const Program &program, const float *in) {
+    float stack[STACK_MAX];
+    float vars[VAR_COUNT] = {};
+    Result result = {0.0f, 1.0f};
+    int sp = 0;  // Next free slot; parse() proved every access in range
+
+    const uint8_t *code = program.code;
+    const uint8_t *end = code + program.length;
+    while (code < end) {
+        const uint8_t op = *code++;
+        switch (op) {
+            case OP_PUSH:
+                memcpy(&stack[sp++], code, sizeof(float));
+                code += sizeof(float);
+                break;
+            case OP_IN:    stack[sp++] = in[*code++]; break;
+            case OP_LOAD:  stack[sp++] = vars[*code++]; break;
+            case OP_STORE: vars[*code++] = stack[--sp]; break;
+
+            case OP_ADD: sp--; stack[sp - 1] += stack[sp]; break;
+            case OP_SUB: sp--; stack[sp - 1] -= stack[sp]; break;
+            case OP_MUL: sp--; stack[sp - 1] *= stack[sp]; break;
+            case OP_DIV:
+                sp--;
+                stack[sp - 1] = stack[sp] != 0.0f ? stack[sp - 1] / stack[sp] : 0.0f;
+                break;
+            case OP_MOD:
+                sp--;
+                stack[sp - 1] = stack[sp] != 0.0f
+                    ? stack[sp - 1] - stack[sp] * floorf(stack[sp - 1] / stack[sp]) : 0.0f;
+                break;
+            case OP_MIN: sp--; stack[sp - 1] = min(stack[sp - 1], stack[sp]); break;
+            case OP_MAX: sp--; stack[sp - 1] = max(stack[sp - 1], stack[sp]); break;
+            case OP_LT:  sp--; stack[sp - 1] = stack[sp - 1] < stack[sp] ? 1.0f : 0.0f; break;
+            case OP_GT:  sp--; stack[sp - 1] = stack[sp - 1] > stack[sp] ? 1.0f : 0.0f; break;
+
+            case OP_NEG:   stack[sp - 1] = -stack[sp - 1]; break;
+            case OP_ABS:   stack[sp - 1] = fabsf(stack[sp - 1]); break;
+            case OP_SIN:   stack[sp - 1] = turnSin(stack[sp - 1]); break;
+            case OP_COS:   stack[sp - 1] = turnSin(stack[sp - 1], 0.25f); break;
+            case OP_FRACT: stack[sp - 1] -= floorf(stack[sp - 1]); break;
+            case OP_FLOOR: stack[sp - 1] = floorf(stack[sp - 1]); break;
+            case OP_SQRT:  stack[sp - 1] = stack[sp - 1] > 0.0f ? sqrtf(stack[sp - 1]) : 0.0f; break;
+            case OP_CLAMP: stack[sp - 1] = constrain(stack[sp - 1], 0.0f, 1.0f); break;
+
+            case OP_SELECT:
+                sp -= 2;
+                stack[sp - 1] = stack[sp - 1] > 0.0f ? stack[sp] : stack[sp + 1];
+                break;
+            case OP_MIX:
+                sp -= 2;
+                stack[sp - 1] += (stack[sp] - stack[sp - 1]) * stack[sp + 1];
+                break;
+
+            case OP_INDEX:  result.index = stack[--sp]; break;
+            case OP_BRIGHT: result.bright = stack[--sp]; break;
+        }
+    }
+    // The renderer turns both into integers
+    result.index = finiteOrZero(result.index);
+    result.bright = finiteOrZero(result.bright);
+    return result;
+}
+
+} // namespace LightVM
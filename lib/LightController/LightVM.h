@@ -0,0 +1,112 @@
+/**
+ * @file LightVM.h
+ * @brief Bytecode interpreter for user-defined light shows (light programs)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * A light program maps per-LED inputs (position, distance to the show center,
+ * phases, audio level and spectrum bands) to a gradient index and a brightness. Programs are
+ * compiled on the host (tools/light_compile.py) into /light_programs/<id>.lpb
+ * next to light_patterns.csv; a pattern selects one with its `program` column.
+ *
+ * Code is straight-line (no jumps; `c ? a : b` is a SELECT), so a program costs
+ * exactly its instruction count per LED. parse() checks opcodes, operands and
+ * stack depth once and refuses programs whose count x NUM_LEDS exceeds
+ * Globals::lightProgramBudget; run() then executes without checks.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace LightVM {
+
+// .lpb file: "LVM1", uint8 code length, code
+constexpr uint8_t MAGIC[4] = {'L', 'V', 'M', '1'};
+constexpr size_t CODE_MAX = 255;
+constexpr uint8_t STACK_MAX = 16;
+constexpr uint8_t VAR_COUNT = 8;
+constexpr uint8_t PROGRAM_SLOTS = 16;  // Program ids 1..PROGRAM_SLOTS-1
+
+enum Op : uint8_t {
+    OP_PUSH   = 0x01,  // f32 operand (little endian)
+    OP_IN     = 0x02,  // Input index operand
+    OP_LOAD   = 0x03,  // Variable index operand
+    OP_STORE  = 0x04,  // Variable index operand (pops)
+
+    OP_ADD    = 0x10,
+    OP_SUB    = 0x11,
+    OP_MUL    = 0x12,
+    OP_DIV    = 0x13,  // x / 0 = 0
+    OP_MOD    = 0x14,  // Floored: result has the sign of the divisor, x mod 0 = 0
+    OP_MIN    = 0x15,
+    OP_MAX    = 0x16,
+    OP_LT     = 0x17,  // 1 or 0
+    OP_GT     = 0x18,
+
+    OP_NEG    = 0x20,
+    OP_ABS    = 0x21,
+    OP_SIN    = 0x22,  // Argument in turns (1.0 = 2 pi), sin16 lookup
+    OP_COS    = 0x23,
+    OP_FRACT  = 0x24,
+    OP_FLOOR  = 0x25,
+    OP_SQRT   = 0x26,  // sqrt(max(x, 0))
+    OP_CLAMP  = 0x27,  // Clamp to 0..1
+
+    OP_SELECT = 0x30,  // c a b -> c > 0 ? a : b
+    OP_MIX    = 0x31,  // a b t -> a + (b - a) * t
+
+    OP_INDEX  = 0x40,  // Pop gradient index (turns: 0..1 spans the gradient, wraps)
+    OP_BRIGHT = 0x41,  // Pop brightness (0..1 of minBrightness..max, clamped)
+};
+
+// Per-frame inputs are set once, per-LED inputs (X..INDEX) for every LED
+enum Input : uint8_t {
+    IN_X,             // LED map position
+    IN_Y,
+    IN_DIST,          // Distance to the (moving) show center
+    IN_INDEX,         // LED index / NUM_LEDS
+    IN_COLOR_PHASE,   // Phase timers, 0..1 per cycle
+    IN_BRIGHT_PHASE,
+    IN_X_PHASE,
+    IN_Y_PHASE,
+    IN_AUDIO,         // Audio level 0..1 while audio plays, else 0
+    IN_RADIUS,        // Animated ring radius of the show
+    IN_FADE_WIDTH,
+    IN_BASS,          // Spectrum bands 0..1 while audio plays, else 0 (AudioSpectrum)
+    IN_MID,
+    IN_HIGH,
+    IN_ONSET,         // 1 on an onset, decays to 0 in ~150 ms
+    IN_COUNT
+};
+
+struct Program {
+    uint8_t code[CODE_MAX];
+    uint8_t length = 0;
+    uint8_t ops = 0;         // Instructions per LED
+    uint16_t inputMask = 0;  // Bit per Input read by the program (frame rate governor)
+};
+
+struct Result {
+    float index;
+    float bright;
+};
+
+// Validate bytecode (.lpb contents) into out. Logs the reason and returns false when refused.
+bool parse(const uint8_t *data, size_t size, Program &out);
+
+// Read /light_programs/<id>.lpb once (loop core, takes the SD lock; never from a
+// web handler). A slot is never rewritten after it loaded, so a frame in flight
+// keeps a valid program. A refused or missing program stays refused until
+// forgetRefused(), so a show that names one costs no SD read per repaint.
+bool load(uint8_t id);
+// Let refused and missing programs be read again (catalog reload)
+void forgetRefused();
+// Loaded program for id, nullptr if none or refused
+const Program *get(uint8_t id);
+
+// Run for one LED; in[] holds all inputs. Result defaults: index 0, brightness 1.
+// Inf or NaN results (and sin/cos arguments) come out as 0.
+Result run(const Program &program, const float *in);
+
+} // namespace LightVM
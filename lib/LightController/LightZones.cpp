@@ -0,0 +1,198 @@
+/**
+ * @file LightZones.cpp
+ * @brief Spatial zones: region parsing, membership and pixel lists
+ * @version 261016V
+ * @date 2026-10-16
+ */
+#include "LightZones.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+namespace LightZones {
+
+namespace {
+
+const char *skipSeparators(const char *p) {
+    while (*p == ' ' || *p == '\t' || *p == ',') p++;
+    return p;
+}
+
+// "a-b, c, d-e" into first/last
+bool parseRanges(const char *def, Region &out, const char *&error) {
+    const char *p = skipSeparators(def);
+    while (*p) {
+        if (out.count >= MAX_POINTS) {
+            error = "too many ranges";
+            return false;
+        }
+        char *end;
+        const long first = strtol(p, &end, 10);
+        if (end == p) {
+            error = "range: index expected";
+            return false;
+        }
+        long last = first;
+        p = end;
+        while (*p == ' ') p++;
+        if (*p == '-') {
+            last = strtol(p + 1, &end, 10);
+            if (end == p + 1) {
+                error = "range: index expected after '-'";
+                return false;
+            }
+            p = end;
+        }
+        if (first < 0 || last < first || last >= NUM_LEDS) {
+            error = "range: indices out of order or past NUM_LEDS";
+            return false;
+        }
+        out.first[out.count] = static_cast<uint16_t>(first);
+        out.last[out.count] = static_cast<uint16_t>(last);
+        out.count++;
+        p = skipSeparators(p);
+    }
+    if (out.count == 0) {
+        error = "range: empty";
+        return false;
+    }
+    return true;
+}
+
+// Up to max numbers separated by spaces or commas; -1 if something else is in the way
+int parseNumbers(const char *def, float *values, int max) {
+    int n = 0;
+    const char *p = skipSeparators(def);
+    while (*p) {
+        if (n == max) return -1;
+        char *end;
+        values[n] = strtof(p, &end);
+        if (end == p || !isfinite(values[n])) return -1;
+        n++;
+        p = skipSeparators(end);
+    }
+    return n;
+}
+
+float wrapDegrees(float deg) {
+    deg = fmodf(deg, 360.0f);
+    return deg < 0.0f ? deg + 360.0f : deg;
+}
+
+} // namespace
+
+bool parseRegion(const char *shape, const char *def, Region &out, const char *&error) {
+    out = Region();
+    error = nullptr;
+    if (!shape || !def) {
+        error = "missing shape or definition";
+        return false;
+    }
+    if (strcasecmp(shape, "range") == 0) {
+        out.shape = Shape::RANGE;
+        return parseRanges(def, out, error);
+    }
+    if (strcasecmp(shape, "angle") == 0) {
+        float v[4];
+        const int n = parseNumbers(def, v, 4);
+        if (n != 2 && n != 4) {
+            error = "angle: expected 'from to' or 'from to cx cy'";
+            return false;
+        }
+        out.shape = Shape::ANGLE;
+        out.fromDeg = wrapDegrees(v[0]);
+        out.spanDeg = wrapDegrees(v[1] - v[0]);
+        if (out.spanDeg == 0.0f) out.spanDeg = 360.0f;
+        if (n == 4) {
+            out.cx = v[2];
+            out.cy = v[3];
+        }
+        return true;
+    }
+    if (strcasecmp(shape, "polygon") == 0) {
+        float v[2 * MAX_POINTS];
+        const int n = parseNumbers(def, v, 2 * MAX_POINTS);
+        if (n < 6 || n % 2 != 0) {
+            error = "polygon: expected 3 to 16 'x y' vertices";
+            return false;
+        }
+        out.shape = Shape::POLYGON;
+        out.count = static_cast<uint8_t>(n / 2);
+        for (uint8_t i = 0; i < out.count; i++) {
+            out.x[i] = v[2 * i];
+            out.y[i] = v[2 * i + 1];
+        }
+        return true;
+    }
+    error = "unknown shape (range, angle, polygon)";
+    return false;
+}
+
+const char *shapeName(Shape shape) {
+    switch (shape) {
+        case Shape::ANGLE:   return "angle";
+        case Shape::POLYGON: return "polygon";
+        case Shape::RANGE:
+        default:             return "range";
+    }
+}
+
+bool contains(const Region &r, uint16_t index, float x, float y) {
+    switch (r.shape) {
+        case Shape::RANGE:
+            for (uint8_t i = 0; i < r.count; i++) {
+                if (index >= r.first[i] && index <= r.last[i]) return true;
+            }
+            return false;
+
+        case Shape::ANGLE: {
+            if (r.spanDeg >= 360.0f) return true;
+            const float deg = atan2f(y - r.cy, x - r.cx) * (180.0f / static_cast<float>(M_PI));
+            return wrapDegrees(deg - r.fromDeg) <= r.spanDeg;
+        }
+
+        case Shape::POLYGON: {
+            // Even-odd rule: count edges crossed by a ray towards +x
+            bool inside = false;
+            for (uint8_t i = 0, j = r.count - 1; i < r.count; j = i++) {
+                if ((r.y[i] > y) != (r.y[j] > y) &&
+                    x < (r.x[j] - r.x[i]) * (y - r.y[i]) / (r.y[j] - r.y[i]) + r.x[i]) {
+                    inside = !inside;
+                }
+            }
+            return inside;
+        }
+    }
+    return false;
+}
+
+void buildPixelLists(const Region *const *regions, uint8_t count, const float *xs, const float *ys,
+                     PixelLists &out) {
+    if (count > MAX_ZONES) count = MAX_ZONES;
+    uint8_t owner[NUM_LEDS];
+    uint16_t size[MAX_ZONES + 1] = {};
+    for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        owner[i] = 0;
+        for (uint8_t z = count; z > 0; z--) {
+            if (contains(*regions[z - 1], i, xs[i], ys[i])) {
+                owner[i] = z;
+                break;
+            }
+        }
+        size[owner[i]]++;
+    }
+
+    out.start[0] = 0;
+    for (uint8_t z = 0; z <= MAX_ZONES; z++) {
+        out.start[z + 1] = out.start[z] + (z <= count ? size[z] : 0);
+    }
+    uint16_t fill[MAX_ZONES + 1];
+    memcpy(fill, out.start, sizeof(fill));
+    for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        out.pixels[fill[owner[i]]++] = i;
+    }
+}
+
+} // namespace LightZones
@@ -0,0 +1,55 @@
+/**
+ * @file LightZones.h
+ * @brief Spatial zones: regions of the LED map that play a show of their own
+ * @version 261016V
+ * @date 2026-10-16
+ *
+ * A zone is a list of index ranges, an angle sector or a polygon in LED map
+ * coordinates (ledmap.bin). Membership is resolved once per zone set and LED
+ * map into pixel lists grouped by zone; the renderer walks every list once per
+ * frame, so a frame stays one pass over NUM_LEDS however many zones there are.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "HWconfig.h"  // for NUM_LEDS
+
+namespace LightZones {
+
+constexpr uint8_t MAX_ZONES = 8;
+constexpr uint8_t MAX_POINTS = 16;  // Ranges of a range zone, vertices of a polygon
+
+enum class Shape : uint8_t {
+    RANGE,    // "0-39, 80-99": LED indices, inclusive
+    ANGLE,    // "from to [cx cy]": sector counter-clockwise from `from` to `to` degrees
+              // (0 = +x) around cx, cy (default the map origin); from == to is the full turn
+    POLYGON   // "x1 y1 x2 y2 x3 y3 ...": at least three vertices
+};
+
+struct Region {
+    Shape shape = Shape::RANGE;
+    uint8_t count = 0;                  // RANGE: ranges, POLYGON: vertices
+    uint16_t first[MAX_POINTS] = {};    // RANGE
+    uint16_t last[MAX_POINTS] = {};
+    float fromDeg = 0.0f, spanDeg = 0.0f;  // ANGLE: fromDeg in [0, 360), spanDeg in (0, 360]
+    float cx = 0.0f, cy = 0.0f;
+    float x[MAX_POINTS] = {};           // POLYGON
+    float y[MAX_POINTS] = {};
+};
+
+// Parse a shape name ("range", "angle", "polygon") and its definition; on failure error
+// names the problem
+bool parseRegion(const char *shape, const char *def, Region &out, const char *&error);
+const char *shapeName(Shape shape);
+bool contains(const Region &region, uint16_t index, float x, float y);
+
+// LEDs grouped by owner: owner 0 is the main show, owner z > 0 is zone z - 1. Owner z has
+// pixels[start[z] .. start[z + 1]) in index order; an LED in several zones goes to the last.
+struct PixelLists {
+    uint16_t start[MAX_ZONES + 2];
+    uint16_t pixels[NUM_LEDS];
+};
+void buildPixelLists(const Region *const *regions, uint8_t count, const float *xs, const float *ys,
+                     PixelLists &out);
+
+} // namespace LightZones
@@ -1,8 +1,8 @@
 /**
  * @file AlertPolicy.h
  * @brief Hardware failure alert business logic
- * @version 260131A
- $12026-02-11
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #pragma once
 
@@ -30,4 +30,7 @@ namespace AlertPolicy {
     constexpr uint32_t COLOR_LUX_SENSOR = 0xFF00FF;  // Magenta
     constexpr uint32_t COLOR_SENSOR3 = 0x00FFFF;  // Cyaan
     constexpr uint32_t COLOR_NAS     = 0x8000FF;  // Paars
+
+    // Status pixels between flash bursts: failure color blended over the show
+    constexpr uint8_t STATUS_PIXEL_ALPHA = 160;
 }
\ No newline at end of file
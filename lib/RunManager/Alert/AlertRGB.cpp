@@ -1,14 +1,13 @@
 /**
  * @file AlertRGB.cpp
  * @brief RGB LED status flash coordination implementation
- * @version 260215B
- * @date 2026-02-15
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #define LOCAL_LOG_LEVEL LOG_LEVEL_INFO
 #include "AlertRGB.h"
 #include "AlertPolicy.h"
-#include "LightController.h"
-#include "Light/LightRun.h"
+#include "LightCompositor.h"
 #include "TimerManager.h"
 #include "StatusFlags.h"
 #include "StatusBits.h"
@@ -33,9 +32,11 @@ constexpr uint8_t MAX_STEPS = 20;
 FlashStep steps[MAX_STEPS];
 uint8_t stepCount = 0;
 
-void applySolid(uint32_t color) {
+// Alert colors are an overlay: the light show keeps animating underneath.
+// The step expires by itself at twice its duration if the sequence stalls.
+void applySolid(uint32_t color, uint32_t durationMs) {
     CRGB c((color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF);
-    PlayLightShow(MakeSolidParams(c));
+    LightCompositor::setSolid(LightLayer::ALERT, c, 255, BlendMode::NORMAL, durationMs * 2);
 }
 
 void addStep(uint32_t color, uint32_t durationMs) {
@@ -50,14 +51,14 @@ void cb_sequenceStep();
 
 void scheduleNextStep() {
     if (sequenceStep >= stepCount) {
-        // Done - restore show
+        // Done - reveal show
         flashing = false;
-        LightRun::reapplyCurrentShow();
+        LightCompositor::clear(LightLayer::ALERT);
         return;
     }
     
-    applySolid(steps[sequenceStep].color);
     uint32_t duration = steps[sequenceStep].durationMs;
+    applySolid(steps[sequenceStep].color, duration);
     sequenceStep++;
     
     // Use restart() - timer may already exist from previous step
@@ -72,6 +73,25 @@ bool isNotOk(uint32_t statusBit) {
     return cachedNotOkBits & (1ULL << statusBit);
 }
 
+// Failure colors in flash order; SD and WiFi are critical (longer flash).
+// Fail bits only cover optional hardware that is present.
+struct Indicator {
+    uint32_t statusBit;
+    uint32_t color;
+    bool critical;
+};
+
+constexpr Indicator INDICATORS[] = {
+    { STATUS_SD_OK,              AlertPolicy::COLOR_SD,              true },
+    { STATUS_WIFI_OK,            AlertPolicy::COLOR_WIFI,            true },
+    { STATUS_RTC_OK,             AlertPolicy::COLOR_RTC,             false },
+    { STATUS_NTP_OK,             AlertPolicy::COLOR_NTP,             false },
+    { STATUS_DISTANCE_SENSOR_OK, AlertPolicy::COLOR_DISTANCE_SENSOR, false },
+    { STATUS_LUX_SENSOR_OK,      AlertPolicy::COLOR_LUX_SENSOR,      false },
+    { STATUS_SENSOR3_OK,         AlertPolicy::COLOR_SENSOR3,         false },
+    { STATUS_NAS_OK,             AlertPolicy::COLOR_NAS,             false },
+};
+
 void buildSequence() {
     stepCount = 0;
     sequenceStep = 0;
@@ -79,38 +99,9 @@ void buildSequence() {
     // Initial black
     addStep(0x000000, Globals::flashNormalMs);
     
-    // SD and WiFi always required
-    if (isNotOk(STATUS_SD_OK)) {
-        addStep(AlertPolicy::COLOR_SD, Globals::flashCriticalMs);
-        addStep(0x000000, Globals::flashNormalMs);
-    }
-    if (isNotOk(STATUS_WIFI_OK)) {
-        addStep(AlertPolicy::COLOR_WIFI, Globals::flashCriticalMs);
-        addStep(0x000000, Globals::flashNormalMs);
-    }
-    // Optional hardware: only flash if PRESENT
-    if (Globals::rtcPresent && isNotOk(STATUS_RTC_OK)) {
-        addStep(AlertPolicy::COLOR_RTC, Globals::flashNormalMs);
-        addStep(0x000000, Globals::flashNormalMs);
-    }
-    if (isNotOk(STATUS_NTP_OK)) {
-        addStep(AlertPolicy::COLOR_NTP, Globals::flashNormalMs);
-        addStep(0x000000, Globals::flashNormalMs);
-    }
-    if (Globals::distanceSensorPresent && isNotOk(STATUS_DISTANCE_SENSOR_OK)) {
-        addStep(AlertPolicy::COLOR_DISTANCE_SENSOR, Globals::flashNormalMs);
-        addStep(0x000000, Globals::flashNormalMs);
-    }
-    if (Globals::luxSensorPresent && isNotOk(STATUS_LUX_SENSOR_OK)) {
-        addStep(AlertPolicy::COLOR_LUX_SENSOR, Globals::flashNormalMs);
-        addStep(0x000000, Globals::flashNormalMs);
-    }
-    if (Globals::sensor3Present && isNotOk(STATUS_SENSOR3_OK)) {
-        addStep(AlertPolicy::COLOR_SENSOR3, Globals::flashNormalMs);
-        addStep(0x000000, Globals::flashNormalMs);
-    }
-    if (isNotOk(STATUS_NAS_OK)) {
-        addStep(AlertPolicy::COLOR_NAS, Globals::flashNormalMs);
+    for (const Indicator &ind : INDICATORS) {
+        if (!isNotOk(ind.statusBit)) continue;
+        addStep(ind.color, ind.critical ? Globals::flashCriticalMs : Globals::flashNormalMs);
         addStep(0x000000, Globals::flashNormalMs);
     }
 }
@@ -120,9 +111,10 @@ void cb_flash() {
     timers.cancel(cb_sequenceStep);
     
     cachedNotOkBits = StatusFlags::getHardwareFailBits();
+    AlertRGB::showStatusPixels();
     if (cachedNotOkBits == 0) {
         flashing = false;
-        LightRun::reapplyCurrentShow();
+        LightCompositor::clear(LightLayer::ALERT);
         return;
     }
 
@@ -148,12 +140,25 @@ void startFlashing() {
 
 void stopFlashing() {
     timers.cancel(cb_flash);
-    applySolid(0);
-    LightRun::reapplyCurrentShow();
+    timers.cancel(cb_sequenceStep);
+    flashing = false;
+    LightCompositor::clear(LightLayer::ALERT);
 }
 
 bool isFlashing() {
     return flashing;
 }
 
+void showStatusPixels() {
+    const uint64_t failBits = StatusFlags::getHardwareFailBits();
+    LightCompositor::clear(LightLayer::STATUS);
+    uint16_t pixel = 0;
+    for (const Indicator &ind : INDICATORS) {
+        if (!(failBits & (1ULL << ind.statusBit))) continue;
+        const uint32_t c = ind.color;
+        LightCompositor::setPixel(LightLayer::STATUS, pixel++, CRGB((c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF),
+                                  AlertPolicy::STATUS_PIXEL_ALPHA);
+    }
+}
+
 } // namespace AlertRGB
\ No newline at end of file
@@ -1,8 +1,8 @@
 /**
  * @file AlertRGB.h
  * @brief RGB LED failure flash coordination
- * @version 260131A
- $12026-02-05
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #pragma once
 
@@ -10,6 +10,8 @@
 
 namespace AlertRGB {
     void startFlashing();  // Start failure flash bursts
-    void stopFlashing();   // Stop and restore normal show
+    void stopFlashing();   // Stop and remove the alert overlay
     bool isFlashing();     // True while flash cycle is active
+    // STATUS layer: one pixel per failing component (LED 0 up, flash order), cleared when all OK
+    void showStatusPixels();
 }
\ No newline at end of file
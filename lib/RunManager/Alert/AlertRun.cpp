@@ -1,8 +1,8 @@
 /**
  * @file AlertRun.cpp
  * @brief Hardware failure alert state management implementation
- * @version 260213A
- * @date 2026-02-13
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #define LOCAL_LOG_LEVEL LOG_LEVEL_INFO
 #include <Arduino.h>
@@ -150,7 +150,8 @@ void AlertRun::plan() {
     AlertState::reset();
     
     // Health status timer
-    timers.create(Globals::healthStatusIntervalMs, 0, cb_healthStatus);
+    timers.create(Globals::healthStatusIntervalMs, 0, cb_healthStatus, 1.0f, 1, TimerPriority::BACKGROUND,
+                  Globals::healthStatusIntervalMs / 4);
 }
 
 void AlertRun::requestWelcome() {
@@ -207,6 +208,7 @@ void AlertRun::report(AlertRequest request) {
             // Welcome queued at clock ready, played after calendar is ready
             break;
     }
+    AlertRGB::showStatusPixels();
 }
 
 void AlertRun::speakOnFail(StatusComponent c) {
@@ -1,8 +1,8 @@
 /**
  * @file AudioRun.cpp
  * @brief Audio playback state management implementation
- * @version 260212D
- * @date 2026-02-12
+ * @version 261016G
+ * @date 2026-10-16
  */
 #include "AudioRun.h"
 
@@ -116,8 +116,6 @@ void AudioRun::cb_volumeShiftTimer()
         lastStatusBits = statusBits;
         applyVolumeShift(statusBits);
     }
-    
-    timers.create(volumeShiftCheckMs, 1, AudioRun::cb_volumeShiftTimer);
 }
 
 void AudioRun::plan()
@@ -128,7 +126,8 @@ void AudioRun::plan()
     // Apply initial volume shift and start periodic timer
     lastStatusBits = StatusFlags::getFullStatusBits();
     applyVolumeShift(lastStatusBits);
-    timers.create(volumeShiftCheckMs, 1, AudioRun::cb_volumeShiftTimer);
+    timers.create(volumeShiftCheckMs, 0, AudioRun::cb_volumeShiftTimer, 1.0f, 1,
+                  TimerPriority::INTERACTIVE, volumeShiftCheckMs / 4);
 }
 
 void AudioRun::startDistanceResponse(bool playImmediately)
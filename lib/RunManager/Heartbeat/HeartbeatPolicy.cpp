@@ -1,8 +1,8 @@
 /**
  * @file HeartbeatPolicy.cpp
  * @brief Heartbeat LED business logic implementation
- * @version 260131A
- $12026-02-09
+ * @version 261016X
+ * @date 2026-10-16
  */
 #include "HeartbeatPolicy.h"
 
@@ -18,6 +18,8 @@ namespace {
 #endif
 
 constexpr uint32_t HEARTBEAT_JITTER_MS = 10;    // minimum delta before updating interval
+constexpr uint16_t FAIL_BREATH_MS = 500;        // failure pattern: 0.5s breath ...
+constexpr uint16_t FAIL_DARK_MS = 3000;         // ... then 3s dark
 
 uint32_t distanceToHeartbeat(float mm) {
 	float clamped = clamp(mm, Globals::distanceMinMm, Globals::distanceMaxMm);
@@ -85,4 +87,19 @@ bool intervalFromDistance(float distanceMm, uint32_t &intervalOut) {
 	return true;
 }
 
+HeartbeatWave waveForInterval(uint32_t intervalMs, bool failing) {
+	HeartbeatWave wave;
+	if (failing) {
+		wave.riseMs = FAIL_BREATH_MS / 2;
+		wave.fallMs = FAIL_BREATH_MS / 2;
+		wave.darkMs = FAIL_DARK_MS;
+		return wave;
+	}
+	const uint16_t half = static_cast<uint16_t>(clampInterval(intervalMs));
+	wave.riseMs = half;
+	wave.fallMs = half;
+	wave.darkMs = 0;
+	return wave;
+}
+
 } // namespace HeartbeatPolicy
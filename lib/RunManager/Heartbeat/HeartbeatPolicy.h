@@ -1,12 +1,13 @@
 /**
  * @file HeartbeatPolicy.h
  * @brief Heartbeat LED business logic
- * @version 260131A
- $12026-02-05
+ * @version 261016X
+ * @date 2026-10-16
  */
 #pragma once
 
 #include <Arduino.h>
+#include "HeartbeatLed.h"
 
 #ifndef HEARTBEAT_DEBUG
 #define HEARTBEAT_DEBUG 0
@@ -29,4 +30,8 @@ bool bootstrap(float distanceMm, uint32_t &intervalOut);
 // Update policy with a new raw distance. Returns true iff the heartbeat interval should change.
 bool intervalFromDistance(float distanceMm, uint32_t &intervalOut);
 
+// Breathing waveform for an interval: fade up and down in one interval each, so a breath
+// lasts two intervals like the old on/off toggle. Failing hardware: short breath, long dark.
+HeartbeatWave waveForInterval(uint32_t intervalMs, bool failing);
+
 } // namespace HeartbeatPolicy
@@ -1,16 +1,16 @@
 /**
  * @file HeartbeatRun.cpp
  * @brief Heartbeat LED state management implementation
- * @version 260205A
- * @date 2026-02-05
+ * @version 261016X
+ * @date 2026-10-16
  */
 #include "HeartbeatRun.h"
 
+#include <atomic>
 #include "Globals.h"
-#include "TimerManager.h"
+#include "HeartbeatLed.h"
 #include "HeartbeatPolicy.h"
 #include "StatusFlags.h"
-#include "StatusBits.h"
 
 namespace {
 
@@ -20,31 +20,12 @@ namespace {
 #define HB_LOG(...) do {} while (0)
 #endif
 
-uint32_t onMs = 500;
-uint32_t offMs = 500;
-bool ledState = false;
+std::atomic<uint32_t> intervalMs{500};  // Set from the sensor loop, read by the LED task
 
-/// Update heartbeat pattern based on hardware failure state
-void updateFailurePattern() {
+/// Asked by HeartbeatLed at every fade: rate from the distance, failure pattern while hardware fails
+HeartbeatWave currentWave() {
     const bool anyFail = StatusFlags::getHardwareFailBits() != 0;
-    if (anyFail) {
-        // Failure pattern: 0.5s on, 3s off
-        onMs = 500;
-        offMs = 3000;
-    } else {
-        // Normal: 0.5s on, 0.5s off
-        onMs = 500;
-        offMs = 500;
-    }
-}
-
-void cb_heartbeat() {
-    ledState = !ledState;
-    digitalWrite(LED_PIN, ledState ? HIGH : LOW);
-    
-    updateFailurePattern();
-    uint32_t nextMs = ledState ? onMs : offMs;
-    timers.restart(nextMs, 1, cb_heartbeat);
+    return HeartbeatPolicy::waveForInterval(intervalMs.load(std::memory_order_relaxed), anyFail);
 }
 
 } // namespace
@@ -53,17 +34,20 @@ HeartbeatRun heartbeatRun;
 
 void HeartbeatRun::plan() {
     HeartbeatPolicy::configure();
-    updateFailurePattern();
-    timers.restart(onMs, 1, cb_heartbeat);
-    HB_LOG("[HeartbeatRun] Started asymmetric heartbeat\n");
+    intervalMs = HeartbeatPolicy::defaultIntervalMs();
+    if (!HeartbeatLed::begin(currentWave)) {
+        PF("[HeartbeatRun] LEDC fade unavailable, heartbeat LED off\n");
+        return;
+    }
+    HB_LOG("[HeartbeatRun] Breathing on LEDC fades\n");
 }
 
-void HeartbeatRun::setRate(uint32_t intervalMs) {
-    // Legacy - now asymmetric, this function is no-op
+void HeartbeatRun::setRate(uint32_t interval) {
+    intervalMs = HeartbeatPolicy::clampInterval(interval);
 }
 
 uint32_t HeartbeatRun::currentRate() const {
-    return onMs;
+    return intervalMs;
 }
 
 void HeartbeatRun::signalError() {
@@ -1,8 +1,8 @@
 /**
  * @file HeartbeatRun.h
  * @brief Heartbeat LED state management
- * @version 260131A
- $12026-02-05
+ * @version 261016X
+ * @date 2026-10-16
  */
 #pragma once
 
@@ -13,7 +13,7 @@ public:
 	void plan();
 	void setRate(uint32_t intervalMs);
 	uint32_t currentRate() const;
-	void signalError();   // Fast blink pattern for errors
+	void signalError();   // Failure pattern follows StatusFlags (LED task)
 
 private:
 	uint32_t _savedRate = 0;
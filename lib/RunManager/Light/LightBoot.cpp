@@ -1,8 +1,8 @@
 /**
  * @file LightBoot.cpp
  * @brief LED show one-time initialization implementation
- * @version 260219C
- * @date 2026-02-19
+ * @version 261016Q
+ * @date 2026-10-16
  */
 #include "LightBoot.h"
 #include "LightController.h"
@@ -15,20 +15,32 @@
 
 namespace {
 
-void cb_updateLightController() { updateLightController(); }
+TimerHandle repaintTimer;
+uint16_t repaintMs = 50;
+
+// Repaint, then follow the frame rate governor (LightController picks the interval per show)
+void cb_updateLightController() {
+    updateLightController();
+    const uint16_t wantMs = getFrameIntervalMs();
+    if (wantMs != repaintMs && timers.restart(repaintTimer, wantMs, 0)) {
+        repaintMs = wantMs;
+    }
+}
 
 // Initialize LED hardware and timers
 void initLight() {
     FastLED.addLeds<LED_TYPE, PIN_RGB, LED_RGB_ORDER>(leds, NUM_LEDS);
-    FastLED.setMaxPowerInVoltsAndMilliamps(MAX_VOLTS, Globals::maxMilliamps);
-    FastLED.setBrightness(Globals::maxBrightness);
+    // Global brightness, dithering and the power limit are applied by LightController
+    FastLED.setBrightness(255);
+    FastLED.setDither(DISABLE_DITHER);
 
     if (!loadLEDMapFromSD("/ledmap.bin")) {
         PF("[LightBoot] LED map fallback active\n");
     }
+    startRenderTask();  // LIGHT_RENDER_TASK builds: frames rendered on the other core
 
-    // LED update timer 50ms (20 FPS)
-    timers.create(50, 0, cb_updateLightController);
+    // LED update timer, 50ms (20 FPS) until the governor adjusts it
+    repaintTimer = timers.create(repaintMs, 0, cb_updateLightController, 1.0f, 1, TimerPriority::REALTIME);
     timers.create((10 * 1000UL) / 255UL, 0, cb_colorCycle);
     timers.create((10 * 1000UL) / 255UL, 0, cb_brightCycle);
 }
@@ -1,8 +1,8 @@
 /**
  * @file LightPolicy.cpp
  * @brief LED show business logic implementation
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016Y
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include <math.h>
@@ -10,6 +10,13 @@
 #include "LightPolicy.h"
 #include "Globals.h"
 
+namespace {
+
+constexpr uint32_t SELF_LIGHT_MIN_MW = 250;   // Below this the LEDs barely reach the sensor
+constexpr uint8_t SELF_LIGHT_MEAN_SAMPLES = 4; // Plain mean of the first samples, then a moving average
+
+}
+
 namespace LightPolicy {
 
 float applyBrightnessRules(float requested) {
@@ -37,6 +44,27 @@ uint8_t calcShiftedHi(float lux, int8_t calendarShift, float webMultiplier) {
     return static_cast<uint8_t>(clamp(brightness, Globals::brightnessLo, Globals::brightnessHi));
 }
 
+bool luxNeedsBlanking(const SelfLightModel& model, uint32_t n, uint32_t ledMw) {
+    if (ledMw < SELF_LIGHT_MIN_MW) return false;
+    if (model.samples == 0) return true;
+    return Globals::luxBlankEvery > 0 && n % Globals::luxBlankEvery == 0;
+}
+
+void learnSelfLight(SelfLightModel& model, float litLux, float darkLux, uint32_t ledMw) {
+    if (ledMw < SELF_LIGHT_MIN_MW) return;
+    // Ratio of averages, not an average of ratios: bright frames weigh more, and sensor noise
+    // at high ambient (lit barely above dark, or below) does not bias the slope
+    const uint8_t weight = model.samples < SELF_LIGHT_MEAN_SAMPLES ? model.samples + 1 : SELF_LIGHT_MEAN_SAMPLES;
+    model.meanLux += (litLux - darkLux - model.meanLux) / weight;
+    model.meanWatts += (static_cast<float>(ledMw) / 1000.0f - model.meanWatts) / weight;
+    model.luxPerWatt = fmaxf(model.meanLux / model.meanWatts, 0.0f);
+    if (model.samples < 255) model.samples++;
+}
+
+float subtractSelfLight(const SelfLightModel& model, float litLux, uint32_t ledMw) {
+    return fmaxf(litLux - model.luxPerWatt * static_cast<float>(ledMw) / 1000.0f, 0.0f);
+}
+
 bool distanceAnimationFor(float distanceMm,
                           uint32_t& frameIntervalMs,
                           float& intensity,
@@ -1,8 +1,8 @@
 /**
  * @file LightPolicy.h
  * @brief LED show business logic
- * @version 260212C
- * @date 2026-02-12
+ * @version 261016Y
+ * @date 2026-10-16
  */
 #pragma once
 #include <Arduino.h>
@@ -17,6 +17,23 @@ namespace LightPolicy {
     // Returns uint8_t Hi value (fully shifted, ready for slider mapping)
     uint8_t calcShiftedHi(float lux, int8_t calendarShift, float webMultiplier);
 
+    // LED self-light at the lux sensor: a lit reading is ambient + luxPerWatt x LED light power.
+    // Learned from blanked measurements (lit reading, then one integration with the LEDs off).
+    struct SelfLightModel {
+        float luxPerWatt = 0.0f;    // meanLux / meanWatts, never below 0
+        float meanLux = 0.0f;       // Lit minus dark reading, averaged
+        float meanWatts = 0.0f;     // LED light power of those readings, averaged
+        uint8_t samples = 0;        // Blanked measurements learned from (saturates at 255)
+    };
+
+    // Blank the LEDs for measurement n? Not while they give (almost) no light; always until the
+    // model has a sample, then every Globals::luxBlankEvery measurements (0 = never again)
+    bool luxNeedsBlanking(const SelfLightModel& model, uint32_t n, uint32_t ledMw);
+    // Learn from a lit reading at ledMw and the blanked reading right after it
+    void learnSelfLight(SelfLightModel& model, float litLux, float darkLux, uint32_t ledMw);
+    // Ambient lux from a lit reading at ledMw (never below 0)
+    float subtractSelfLight(const SelfLightModel& model, float litLux, uint32_t ledMw);
+
     // Placeholder: distance-driven light show adjustment
     bool distanceAnimationFor(float distanceMm,
                               uint32_t& frameIntervalMs,
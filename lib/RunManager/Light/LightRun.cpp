@@ -1,19 +1,22 @@
 /**
  * @file LightRun.cpp
  * @brief LED show state management implementation
- * @version 260216J
- * @date 2026-02-16
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #include "LightRun.h"
 
 #include "Globals.h"
 #include "LightPolicy.h"
 #include "LightController.h"
+#include "LightPower.h"
+#include "LightVM.h"
 #include "SensorController.h"
 #include "TimerManager.h"
 #include "ColorsCatalog.h"
 #include "PatternCatalog.h"
 #include "ShiftTable.h"
+#include "ZoneTable.h"
 #include "StatusFlags.h"
 #include "TodayModels.h"
 #include "Alert/AlertRGB.h"
@@ -22,8 +25,8 @@
 #include "NasBackup.h"
 #include <FastLED.h>
 
-// Alias for readability — Globals::brightnessFading
-static inline bool& brightnessFading = Globals::brightnessFading;
+// Alias for readability — Globals::luxBlanking
+static inline bool& luxBlanking = Globals::luxBlanking;
 
 namespace {
 
@@ -32,15 +35,20 @@ bool luxMeasureActive = false;
 bool luxRequestPending = false;      // Slider requested measurement (B6)
 bool luxInCooldown = false;          // 100ms cooldown active (B6)
 
-// Brightness fade state — uses shared Globals::fadeCurve (15-step sine²)
-constexpr uint16_t brightnessFadeMs = 400;
-constexpr uint16_t brightnessStepMs = brightnessFadeMs / Globals::fadeStepCount;  // ~26ms
-uint8_t  fadeStep = 0;
-uint8_t  fadeStartBrightness = 0;
+// The sensor reads the light of its last 25 ms integration, LEDs included. Most measurements
+// subtract the LEDs' share from the shown frame's power; every Globals::luxBlankEvery-th one
+// blanks the LEDs for one integration (~40 ms) to get the ambient alone and teach the model.
+constexpr uint16_t LUX_SETTLE_MS = 10;  // Dark frame on the strip (render task, 160 LEDs ~5 ms)
+LightPolicy::SelfLightModel selfLight;
+uint32_t luxMeasurements = 0;
+float luxLit = 0.0f;                 // Reading before the blanking ...
+uint32_t luxLitMw = 0;               // ... and the LED light power it saw
 
-void applyFadeBrightness(uint8_t bri) {
-    FastLED.setBrightness(bri);
-    FastLED.show();
+// Shown frame's power minus the idle draw of the LEDs, which gives no light
+uint32_t ledLightMilliwatts() {
+    const uint32_t idleMw = static_cast<uint32_t>(NUM_LEDS) * LightPower::DARK_MW;
+    const uint32_t mw = getLedMilliwatts();
+    return mw > idleMw ? mw - idleMw : 0;
 }
 
 uint32_t currentIntervalMs = 0;
@@ -115,7 +123,8 @@ void stopAnimation() {
 bool scheduleShiftTimer() {
     TimerCallback cb = LightRun::cb_shiftTimer;
     // Use restart() - called repeatedly to reschedule shift checks
-    if (!timers.restart(Globals::shiftCheckIntervalMs, 1, cb)) {
+    if (!timers.restart(Globals::shiftCheckIntervalMs, 1, cb, 1.0f, 1,
+                        TimerPriority::INTERACTIVE, Globals::shiftCheckIntervalMs / 4)) {
         PF("[LightRun] Failed to create shift timer (%lu ms)\n",
            static_cast<unsigned long>(Globals::shiftCheckIntervalMs));
         shiftTimerActive = false;
@@ -137,6 +146,11 @@ void LightRun::plan() {
     // This avoids lazy SD reads inside web request handlers during audio playback.
     getPatternCatalog();
     getColorsCatalog();
+    // Programs the previous catalogs found missing or refused get another read (repaint tick)
+    LightVM::forgetRefused();
+
+    // Zones resolve their pattern and colors from the catalogs
+    ZoneTable::instance().begin();
     
     // Apply immediately and start periodic check timer
     lastStatusBits = StatusFlags::getFullStatusBits();
@@ -144,7 +158,8 @@ void LightRun::plan() {
     scheduleShiftTimer();
     
     // Periodic lux measurement (Light's responsibility)
-    timers.create(Globals::luxMeasurementIntervalMs, 0, LightRun::cb_luxMeasure);
+    timers.create(Globals::luxMeasurementIntervalMs, 0, LightRun::cb_luxMeasure, 1.0f, 1,
+                  TimerPriority::INTERACTIVE, Globals::luxMeasurementIntervalMs / 4);
     
     // Periodic random color/pattern changes (independent timers)
     timers.create(Globals::colorChangeIntervalMs, 0, LightRun::cb_changeColor);
@@ -193,25 +208,12 @@ void LightRun::cb_shiftTimer() {
     scheduleShiftTimer();
 }
 
-void LightRun::cb_luxMeasure() {
-    // Skip if no lux sensor present (preserves boot default brightness)
-    if (!AlertState::isLuxSensorOk()) return;
-    if (brightnessFading) return;  // Guard: fade already in progress
-    
-    luxMeasureActive = true;
-    fadeStartBrightness = getBrightnessShiftedHi();
-    fadeStep = 0;
-    brightnessFading = true;
-    timers.create(brightnessStepMs, Globals::fadeStepCount, LightRun::cb_fadeBrightnessOut);
-}
+namespace {
 
-void LightRun::cb_measureLux() {
-    if (!luxMeasureActive) return;  // Guard: measurement was cancelled
+// Ambient lux of a measurement → brightness, repaint, cooldown
+void applyLux(float lux) {
     luxMeasureActive = false;
-    
-    // LEDs are now at 0 brightness — read sensor
-    SensorController::performLuxMeasurement();
-    float lux = SensorController::ambientLux();
+    SensorController::setAmbientLux(lux);
     
     // Compute new brightness from lux + calendar shift + web shift
 #ifndef DISABLE_SHIFTS
@@ -228,52 +230,75 @@ void LightRun::cb_measureLux() {
     
     PF("[LightRun] Lux=%.1f calShift=%d webMultiplier=%.2f → shiftedHi=%u\n", lux, calendarShift, getWebMultiplier(), shiftedHi);
     
-    // Repaint LED buffer with current pattern/colors, but keep brightness at 0
-    // The fader will ramp up to shiftedHi smoothly
-    applyToLights();
+    // Repaint with current pattern/colors at the new brightness
+    LightRun::applyToLights();
     WebGuiStatus::pushState();
     
-    // Fade in smoothly to new brightness (400ms sine² curve)
-    fadeStartBrightness = getBrightnessShiftedHi();
-    fadeStep = 0;
-    brightnessFading = true;
-    timers.create(brightnessStepMs, Globals::fadeStepCount, LightRun::cb_fadeBrightnessIn);
-    
     // Cooldown, check for pending slider request
     luxInCooldown = true;
     timers.create(100, 1, LightRun::cb_cooldownExpired);
     if (luxRequestPending) {
-        // Schedule retry after fade-in completes (~400ms) + cooldown (100ms)
-        timers.create(500, 1, LightRun::cb_tryLuxMeasure);
+        // Schedule retry after cooldown (100ms)
+        timers.create(150, 1, LightRun::cb_tryLuxMeasure);
     }
 }
 
-void LightRun::cb_cooldownExpired() {
-    luxInCooldown = false;
-}
+} // namespace
 
-void LightRun::cb_fadeBrightnessOut() {
-    if (!brightnessFading) return;
-    uint8_t idx = (Globals::fadeStepCount - 1) - fadeStep;
-    uint8_t bri = static_cast<uint8_t>(fadeStartBrightness * Globals::fadeCurve[idx]);
-    applyFadeBrightness(bri);
-    fadeStep++;
-    if (fadeStep >= Globals::fadeStepCount) {
-        applyFadeBrightness(0);
-        brightnessFading = false;
-        cb_measureLux();   // LEDs dark → read sensor
+void LightRun::cb_luxMeasure() {
+    // Skip if no lux sensor present (preserves boot default brightness)
+    if (!AlertState::isLuxSensorOk()) return;
+    if (luxMeasureActive) return;  // Guard: blanking already in progress
+    
+    luxMeasureActive = true;
+    SensorController::performLuxMeasurement();
+    const float lit = SensorController::ambientLux();
+    const uint32_t ledMw = ledLightMilliwatts();
+    if (!LightPolicy::luxNeedsBlanking(selfLight, luxMeasurements++, ledMw)) {
+        applyLux(LightPolicy::subtractSelfLight(selfLight, lit, ledMw));
+        return;
     }
+    
+    // Blank: the repaint timer leaves the brightness alone until cb_measureLux
+    luxLit = lit;
+    luxLitMw = ledMw;
+    luxBlanking = true;
+    showBrightness(0);
+    timers.create(LUX_SETTLE_MS, 1, LightRun::cb_luxBlanked, 1.0f, 1, TimerPriority::REALTIME);
 }
 
-void LightRun::cb_fadeBrightnessIn() {
-    if (!brightnessFading) return;
-    uint8_t bri = static_cast<uint8_t>(fadeStartBrightness * Globals::fadeCurve[fadeStep]);
-    applyFadeBrightness(bri);
-    fadeStep++;
-    if (fadeStep >= Globals::fadeStepCount) {
-        applyFadeBrightness(fadeStartBrightness);
-        brightnessFading = false;
+void LightRun::cb_luxBlanked() {
+    if (!luxMeasureActive) return;  // Guard: measurement was cancelled
+    
+    // LEDs are dark now — integrate once without them
+    const uint16_t waitMs = SensorController::restartLuxIntegration();
+    if (waitMs == 0) {
+        // Sensor dropped out: keep the lit reading, corrected by the model
+        luxBlanking = false;
+        updateLightController();
+        applyLux(LightPolicy::subtractSelfLight(selfLight, luxLit, luxLitMw));
+        return;
     }
+    timers.create(waitMs, 1, LightRun::cb_measureLux, 1.0f, 1, TimerPriority::REALTIME);
+}
+
+void LightRun::cb_measureLux() {
+    if (!luxMeasureActive) return;  // Guard: measurement was cancelled
+    
+    SensorController::performLuxMeasurement();
+    const float dark = SensorController::ambientLux();
+    luxBlanking = false;
+    updateLightController();  // Back to the show's brightness now, not at the next repaint tick
+    
+    LightPolicy::learnSelfLight(selfLight, luxLit, dark, luxLitMw);
+    // Recorded data for tools/host_tests/test_lux_self_light --lux-log
+    PF("[LightRun] Lux blanked: lit=%.2f dark=%.2f led=%lumW -> %.2f lux/W\n", luxLit, dark,
+       static_cast<unsigned long>(luxLitMw), selfLight.luxPerWatt);
+    applyLux(dark);
+}
+
+void LightRun::cb_cooldownExpired() {
+    luxInCooldown = false;
 }
 
 // B6: Slider-triggered lux measurement with debounce + 100ms cooldown
@@ -729,10 +754,6 @@ void LightRun::applyToLights() {
     PlayLightShow(params);
 }
 
-void LightRun::reapplyCurrentShow() {
-    applyToLights();
-}
-
 void LightRun::cb_changeColor() {
     if (colorSource != LightSource::MANUAL) {
         ColorsCatalog& colCat = getColorsCatalog();
@@ -1,8 +1,8 @@
 /**
  * @file LightRun.h
  * @brief LED show state management
- * @version 260202A
- $12026-02-10
+ * @version 261016Y
+ * @date 2026-10-16
  */
 #pragma once
 
@@ -30,9 +30,8 @@ public:
     static void cb_animation();
     static void cb_shiftTimer();
     static void cb_luxMeasure();
+    static void cb_luxBlanked();
     static void cb_measureLux();
-    static void cb_fadeBrightnessOut();
-    static void cb_fadeBrightnessIn();
     static void cb_tryLuxMeasure();
     static void cb_cooldownExpired();
     static void cb_changeColor();
@@ -67,9 +66,6 @@ public:
     // Apply combined pattern+color to lights (call after any pattern/color change)
     static void applyToLights();
     
-    // Reapply current pattern/color (used by AlertRGB to restore after alert)
-    static void reapplyCurrentShow();
-
     static bool selectPattern(const String &id, String &errorMessage);
     static bool selectNextPattern(String &errorMessage);
     static bool selectPrevPattern(String &errorMessage);
@@ -1,8 +1,8 @@
 /**
  * @file PatternCatalog.cpp
  * @brief LED pattern storage implementation
- * @version 260218E
- * @date 2026-02-18
+ * @version 261016W
+ * @date 2026-10-16
  */
 #define LOCAL_LOG_LEVEL LOG_LEVEL_INFO
 #include "PatternCatalog.h"
@@ -125,6 +125,11 @@ String PatternCatalog::buildJson(const char* source) const {
         out += F(",\"y_amp\":");          out += String(entry.params.yAmp, 3);
         out += F(",\"x_cycle_sec\":");    out += entry.params.xCycleSec;
         out += F(",\"y_cycle_sec\":");    out += entry.params.yCycleSec;
+        out += F(",\"program\":");        out += entry.params.program;
+        out += F(",\"baked\":");          out += entry.params.baked;
+        out += F(",\"noise_size\":");     out += String(entry.params.noiseSize, 3);
+        out += F(",\"noise_speed\":");    out += String(entry.params.noiseSpeed, 3);
+        out += F(",\"noise_fps\":");      out += entry.params.noiseFps;
         out += F("}}");
     }
     out += F("]}");
@@ -378,6 +383,11 @@ bool PatternCatalog::parseParams(JsonVariantConst src, LightShowParams& out, Str
     out.yAmp           = obj["y_amp"].as<float>();
     out.xCycleSec      = obj["x_cycle_sec"].as<uint8_t>();
     out.yCycleSec      = obj["y_cycle_sec"].as<uint8_t>();
+    out.program        = obj["program"].as<uint8_t>();
+    out.baked          = obj["baked"].as<uint8_t>();
+    out.noiseSize      = obj["noise_size"].as<float>();
+    out.noiseSpeed     = obj["noise_speed"].as<float>();
+    out.noiseFps       = obj["noise_fps"].as<uint8_t>();
     return true;
 }
 
@@ -479,6 +489,11 @@ bool PatternCatalog::loadFromSD() {
         params.yAmp           = toFloat(columns[13]);
         params.xCycleSec      = static_cast<uint8_t>(toFloat(columns[14]));
         params.yCycleSec      = static_cast<uint8_t>(toFloat(columns[15]));
+        params.program        = columns.size() > 16 ? static_cast<uint8_t>(columns[16].toInt()) : 0;  // Optional column
+        params.baked          = columns.size() > 17 ? static_cast<uint8_t>(columns[17].toInt()) : 0;  // Optional column
+        params.noiseSize      = columns.size() > 18 ? toFloat(columns[18]) : 0.0f;  // Optional column
+        params.noiseSpeed     = columns.size() > 19 ? toFloat(columns[19]) : 0.0f;  // Optional column
+        params.noiseFps       = columns.size() > 20 ? static_cast<uint8_t>(columns[20].toInt()) : 0;  // Optional column
 
         entry.params = params;
         patterns_.push_back(entry);
@@ -503,7 +518,7 @@ bool PatternCatalog::saveToSD() const {
         file.println(activePatternId_);
     }
 
-    file.println(F("light_pattern_id;light_pattern_name;color_cycle_sec;bright_cycle_sec;fade_width;min_brightness;gradient_speed;center_x;center_y;radius;window_width;radius_osc;x_amp;y_amp;x_cycle_sec;y_cycle_sec"));
+    file.println(F("light_pattern_id;light_pattern_name;color_cycle_sec;bright_cycle_sec;fade_width;min_brightness;gradient_speed;center_x;center_y;radius;window_width;radius_osc;x_amp;y_amp;x_cycle_sec;y_cycle_sec;program;baked;noise_size;noise_speed;noise_fps"));
 
     for (const auto& entry : patterns_) {
         file.print(entry.id);
@@ -537,6 +552,16 @@ bool PatternCatalog::saveToSD() const {
         file.print(entry.params.xCycleSec);
         file.print(';');
         file.print(entry.params.yCycleSec);
+        file.print(';');
+        file.print(entry.params.program);
+        file.print(';');
+        file.print(entry.params.baked);
+        file.print(';');
+        file.print(entry.params.noiseSize, 3);
+        file.print(';');
+        file.print(entry.params.noiseSpeed, 3);
+        file.print(';');
+        file.print(entry.params.noiseFps);
         file.println();
     }
 
@@ -0,0 +1,114 @@
+/**
+ * @file ZoneTable.cpp
+ * @brief Spatial light zones from SD implementation
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#include <Arduino.h>
+#include "ZoneTable.h"
+#include "CsvUtils.h"
+#include "SDController.h"
+#include "Globals.h"
+#include "SdPathUtils.h"
+#include "ColorsCatalog.h"
+#include "PatternCatalog.h"
+#include "Alert/AlertState.h"
+
+namespace {
+    constexpr const char* kZonePath = "/light_zones.csv";
+
+    // zone_id;zone_name;shape;region;light_pattern_id;light_colors_id;brightness
+    enum Column : uint8_t { COL_ID, COL_NAME, COL_SHAPE, COL_REGION, COL_PATTERN, COL_COLORS, COL_BRIGHTNESS, COL_COUNT };
+}
+
+ZoneTable& ZoneTable::instance() {
+    static ZoneTable inst;
+    return inst;
+}
+
+bool ZoneTable::begin() {
+    if (ready_) {
+        return true;
+    }
+
+    const bool ok = loadFromSD();
+    setLightZones(zones_.data(), static_cast<uint8_t>(zones_.size()));
+    if (!zones_.empty()) {
+        PF_BOOT("[ZoneTable] %u light zones\n", static_cast<unsigned>(zones_.size()));
+    }
+
+    ready_ = true;  // Mark ready even if the file is missing (the main show covers all LEDs)
+    return ok;
+}
+
+bool ZoneTable::loadFromSD() {
+    if (!AlertState::isSdOk()) {
+        return false;
+    }
+    const String csvPath = SdPathUtils::chooseCsvPath(kZonePath);
+    if (csvPath.isEmpty() || !SDController::fileExists(csvPath.c_str())) {
+        return false;
+    }
+    File file = SDController::openFileRead(csvPath.c_str());
+    if (!file) {
+        return false;
+    }
+
+    zones_.clear();
+    names_.clear();
+
+    const PatternCatalog& patterns = PatternCatalog::instance();
+    const ColorsCatalog& colors = ColorsCatalog::instance();
+
+    String line;
+    std::vector<String> columns;
+    columns.reserve(COL_COUNT);
+    bool headerConsumed = false;
+
+    while (csv::readLine(file, line)) {
+        String trimmed = line;
+        trimmed.trim();
+        if (trimmed.isEmpty() || trimmed.charAt(0) == '#') continue;
+        if (!headerConsumed) {
+            headerConsumed = true;
+            if (trimmed.startsWith(F("zone_id"))) continue;
+        }
+
+        csv::splitColumns(line, columns);
+        if (columns.size() < COL_COUNT - 1) {
+            PF("[ZoneTable] Skipping short line: %s\n", trimmed.c_str());
+            continue;
+        }
+        if (zones_.size() >= LightZones::MAX_ZONES) {
+            PF("[ZoneTable] More than %u zones, rest ignored\n", LightZones::MAX_ZONES);
+            break;
+        }
+
+        const String& id = columns[COL_ID];
+        LightZone zone;
+        const char* error = nullptr;
+        if (!LightZones::parseRegion(columns[COL_SHAPE].c_str(), columns[COL_REGION].c_str(), zone.region, error)) {
+            PF("[ZoneTable] Zone %s: %s\n", id.c_str(), error);
+            continue;
+        }
+        if (!patterns.getParamsForId(columns[COL_PATTERN], zone.show)) {
+            PF("[ZoneTable] Zone %s: unknown pattern '%s'\n", id.c_str(), columns[COL_PATTERN].c_str());
+            continue;
+        }
+        String colorLabel;
+        if (!colors.getColorById(columns[COL_COLORS], colorLabel, zone.show.RGB1, zone.show.RGB2)) {
+            PF("[ZoneTable] Zone %s: unknown color set '%s'\n", id.c_str(), columns[COL_COLORS].c_str());
+            continue;
+        }
+        // Empty brightness = as the main show
+        if (columns.size() > COL_BRIGHTNESS && !columns[COL_BRIGHTNESS].isEmpty()) {
+            zone.brightness = static_cast<uint8_t>(constrain(columns[COL_BRIGHTNESS].toInt(), 0, 255));
+        }
+
+        zones_.push_back(zone);
+        names_.push_back(columns[COL_NAME].isEmpty() ? id : columns[COL_NAME]);
+    }
+
+    SDController::closeFile(file);
+    return true;
+}
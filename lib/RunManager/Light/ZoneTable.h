@@ -0,0 +1,34 @@
+/**
+ * @file ZoneTable.h
+ * @brief Spatial light zones from SD (light_zones.csv)
+ * @version 261016V
+ * @date 2026-10-16
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "LightController.h"
+
+class ZoneTable {
+public:
+    static ZoneTable& instance();
+
+    // Load /light_zones.csv, resolve each zone's pattern and colors from the catalogs
+    // (load those first) and hand the zones to LightController (call at boot)
+    bool begin();
+    bool isReady() const { return ready_; }
+
+    size_t zoneCount() const { return zones_.size(); }
+    const LightZone* zones() const { return zones_.data(); }
+    const String& zoneName(size_t index) const { return names_[index]; }
+
+private:
+    ZoneTable() = default;
+
+    bool loadFromSD();
+
+    std::vector<LightZone> zones_;
+    std::vector<String> names_;
+    bool ready_{false};
+};
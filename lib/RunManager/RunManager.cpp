@@ -1,8 +1,8 @@
 /**
  * @file RunManager.cpp
  * @brief Central run coordinator for all Kwal modules
- * @version 260227A
- * @date 2026-02-26
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include <math.h>
@@ -372,7 +372,7 @@ void RunManager::update() {
     audio.update();
 #if LOG_HEARTBEAT
     static uint32_t lastHeartbeatMs = 0;
-    uint32_t now = millis();
+    uint32_t now = timers.now();
     if (now - lastHeartbeatMs >= 1000U) {
         LOG_HEARTBEAT_TICK('.');
         lastHeartbeatMs = now;
@@ -380,6 +380,11 @@ void RunManager::update() {
 #endif
 }
 
+bool RunManager::canIdle() {
+    // MP3 decoder and PCM clips are pumped from update(); never sleep while they run
+    return Globals::loopIdleMaxMs > 0 && !isAudioBusy();
+}
+
 void RunManager::requestPlayFragment(const char* source) {
     if (!AlertState::canPlayFragment()) {
         RUN_LOG_WARN("[AudioRun] playback blocked by policy\n");
@@ -443,8 +448,8 @@ void RunManager::requestPlaySpecificFragment(uint8_t dir, int8_t file, const cha
         // Stash fragment, stop current, play after fade-out
         pendingFragment = fragment;
         hasPendingFragment = true;
-        timers.cancel(cb_stopThenPlayPending);
-        timers.create(1, 1, cb_stopThenPlayPending);
+        timers.restart(1, 1, cb_stopThenPlayPending);
+        timers.wake();  // Web task: the loop may be asleep for up to loopIdleMaxMs
         return;
     }
     
@@ -497,8 +502,7 @@ void RunManager::requestSetAudioLevel(float value) {
     // F9 pattern: webMultiplier can be >1.0, no clamp
     audio.setVolumeWebMultiplier(value);
     // Arm/reset shared expiry — any web audio change resets countdown
-    timers.cancel(cb_clearWebAudio);
-    timers.create(webExpiryMs, 1, cb_clearWebAudio);
+    timers.restart(webExpiryMs, 1, cb_clearWebAudio);
     RUN_LOG_INFO("[AudioRun] webMultiplier=%.2f\n",
                      static_cast<double>(value));
 }
@@ -510,8 +514,8 @@ void RunManager::requestSetAudioIntervals(
 {
     pendingIntervals = {speakMinMs, speakMaxMs, fragMinMs, fragMaxMs,
                         durationMs, silence, hasSpeakRange, hasFragRange};
-    timers.cancel(cb_applyAudioIntervals);
-    timers.create(1, 1, cb_applyAudioIntervals);
+    timers.restart(1, 1, cb_applyAudioIntervals);
+    timers.wake();
 }
 
 void RunManager::requestSetSilence(bool active) {
@@ -521,8 +525,7 @@ void RunManager::requestSetSilence(bool active) {
         PlaySentence::stop();
     }
     // Arm/reset shared expiry
-    timers.cancel(cb_clearWebAudio);
-    timers.create(webExpiryMs, 1, cb_clearWebAudio);
+    timers.restart(webExpiryMs, 1, cb_clearWebAudio);
 }
 
 bool RunManager::requestStartClockTick(bool fallbackEnabled) {
@@ -613,13 +616,13 @@ void RunManager::resumeAfterWiFiBoot() {
 void RunManager::requestWebAudioNext(uint16_t fadeMs) {
     AudioPolicy::resetToBaseThemeBox();  // Clear any single-dir override
     webAudioNextFadeMs = fadeMs;
-    timers.cancel(cb_webAudioStopThenNext);
-    timers.create(1, 1, cb_webAudioStopThenNext);
+    timers.restart(1, 1, cb_webAudioStopThenNext);
+    timers.wake();  // Web task: the loop may be asleep for up to loopIdleMaxMs
 }
 
 void RunManager::requestStartSync() {
-    timers.cancel(cb_startSync);
-    timers.create(1, 1, cb_startSync);
+    timers.restart(1, 1, cb_startSync);
+    timers.wake();
 }
 
 void RunManager::requestStopSync() {
@@ -1,8 +1,8 @@
 /**
  * @file RunManager.h
  * @brief Central coordinator header for all Kwal modules
- * @version 260226B
- * @date 2026-02-26
+ * @version 261016C
+ * @date 2026-10-16
  */
 #pragma once
 #include <Arduino.h>
@@ -20,6 +20,7 @@ public:
     // Lifecycle
     static void begin();
     static void update();
+    static bool canIdle();   // loop() may sleep until next timer (no audio to pump)
 
     // Requests (external inputs)
     static void requestPlayFragment(const char* source = "timer");
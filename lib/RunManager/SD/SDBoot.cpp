@@ -1,8 +1,8 @@
 /**
  * @file SDBoot.cpp
  * @brief SD card one-time initialization implementation
- * @version 260218N
- * @date 2026-02-18
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include "SDBoot.h"
@@ -268,6 +268,7 @@ void SDBoot::requestRebuild() {
         return;
     }
     timers.create(100, 1, cb_deferredRebuild);
+    timers.wake();  // Web task: let the loop pick up the new deadline
     PF("[SDBoot] Rebuild requested\n");
 }
 
@@ -285,6 +286,7 @@ void SDBoot::requestSyncDir(uint8_t dirNum) {
     if (dirNum == 0) return;
     pendingSyncDir = dirNum;
     timers.create(100, 1, cb_deferredSyncDir);
+    timers.wake();
     PF("[SDBoot] SyncDir %03u requested\n", dirNum);
 }
 
@@ -1,8 +1,8 @@
 /**
  * @file SDRun.cpp
  * @brief SD card state management with periodic health check
- * @version 260218C
- * @date 2026-02-18
+ * @version 261016G
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include "SDRun.h"
@@ -18,7 +18,8 @@ void SDRun::plan() {
         return;  // SD not mounted — nothing to monitor
     }
     // Start periodic health check (infinite timer, fires every sdHealthCheckIntervalMs)
-    timers.create(Globals::sdHealthCheckIntervalMs, 0, cb_checkSdHealth);
+    timers.create(Globals::sdHealthCheckIntervalMs, 0, cb_checkSdHealth, 1.0f, 1, TimerPriority::BACKGROUND,
+                  Globals::sdHealthCheckIntervalMs / 4);
 }
 
 void SDRun::cb_checkSdHealth() {
@@ -1,8 +1,8 @@
 /**
  * @file WiFiBoot.cpp
  * @brief WiFi connection one-time initialization implementation
- * @version 260212G
- * @date 2026-02-12
+ * @version 261016E
+ * @date 2026-10-16
  */
 #include "WiFiBoot.h"
 #include "Globals.h"
@@ -222,14 +222,14 @@ namespace {
         }
 
         if (!wifiUp) {
-            const uint32_t now = millis();
+            const uint32_t now = timers.now();
             if (now - lastWaitLogMs >= WIFI_WAIT_LOG_INTERVAL_MS) {
                 PL("[Main] WiFi not connected yet");
                 lastWaitLogMs = now;
             }
         }
         else {
-            lastWaitLogMs = millis();
+            lastWaitLogMs = timers.now();
         }
 
         lastWiFiState = wifiUp;
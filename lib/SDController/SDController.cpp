@@ -1,8 +1,8 @@
 /**
  * @file SDController.cpp
  * @brief SD card control implementation with directory scanning and file indexing
- * @version 260218C
- * @date 2026-02-18
+ * @version 261016U
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include "SDController.h"
@@ -470,6 +470,38 @@ void SDController::closeFile(File& file) {
     unlockSD();
 }
 
+File SDController::openStream(const char* path) {
+    if (!path) {
+        return File();
+    }
+    lockSD();
+    File f = SD.open(path, FILE_READ);
+    unlockSD();
+    return f;
+}
+
+size_t SDController::readStream(File& file, uint32_t pos, uint8_t* buf, size_t len) {
+    if (!file) {
+        return 0;
+    }
+    lockSD();
+    size_t got = 0;
+    if (file.position() == pos || file.seek(pos)) {
+        got = file.read(buf, len);
+    }
+    unlockSD();
+    return got;
+}
+
+void SDController::closeStream(File& file) {
+    if (!file) {
+        return;
+    }
+    lockSD();
+    file.close();
+    unlockSD();
+}
+
 // === Free function ===
 
 const char* getMP3Path(uint8_t dirID, uint8_t fileID) {
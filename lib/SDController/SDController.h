@@ -1,8 +1,8 @@
 /**
  * @file SDController.h
  * @brief SD card control interface with directory scanning and file indexing
- * @version 260217D
- * @date 2026-02-17
+ * @version 261016U
+ * @date 2026-10-16
  */
 #pragma once
 #include <Arduino.h>
@@ -76,6 +76,13 @@ public:
     static File openFileWrite(const char* path);
     static void closeFile(File& file);  // Calls unlockSD()
 
+    // === Long-lived readers (baked light shows) ===
+    // The file stays open, but the lock is held only inside each call, so other SD
+    // users (MP3 stream, votes, NAS backup) get the card between reads
+    static File   openStream(const char* path);
+    static size_t readStream(File& file, uint32_t pos, uint8_t* buf, size_t len);  // Seek + read
+    static void   closeStream(File& file);
+
 private:
     static std::atomic<bool> ready_;
     static std::atomic<uint8_t> lockCount_;
@@ -1,8 +1,8 @@
 /**
  * @file SensorController.cpp
  * @brief Sensor initialization and reading for distance (VL53L1X) and lux (BH1750/VEML7700)
- * @version 260215B
- * @date 2026-02-15
+ * @version 261016Y
+ * @date 2026-10-16
  */
 // lib/SensorController20251004/SensorController.cpp
 #define LOCAL_LOG_LEVEL LOG_LEVEL_INFO
@@ -57,8 +57,17 @@ namespace {
     return VL53L1X_begin();
   }
 
+  // VEML7700 at its shortest integration time: a reading covers the last 25 ms, so LightRun
+  // blanks the LEDs for one integration only. Gain 2 keeps 0.115 lux per count.
+  constexpr uint16_t LUX_INTEGRATION_MS = 25;
+  constexpr uint16_t LUX_WAKE_MS = 3;         // Power-on to first integration (datasheet 2.5 ms)
+  constexpr uint16_t LUX_MARGIN_MS = 5;       // Timer jitter before the result is read
+
   bool probeLuxSensor() {
-    return veml7700.begin();
+    if (!veml7700.begin()) return false;
+    veml7700.setGain(VEML7700_GAIN_2);
+    veml7700.setIntegrationTime(VEML7700_IT_25MS);
+    return true;
   }
 
   // Per-device init callbacks
@@ -73,7 +82,7 @@ namespace {
   // Lux sensor read callback
   void cb_luxSensorRead() {
     if (!I2CInitHelper::isReady(SC_LUX)) return;
-    float lux = veml7700.readLux();
+    float lux = veml7700.readLux(VEML_LUX_NORMAL_NOWAIT);  // Last completed integration
     SensorController::setAmbientLux(lux);
 #if LOCAL_LOG_LEVEL >= LOG_LEVEL_INFO
     PF("[LuxSensor] %.1f lux\n", lux);
@@ -141,10 +150,18 @@ void SensorController::beginLuxSensor() {
 }
 
 void SensorController::performLuxMeasurement() {
-  // Called by RunManager after LEDs are off and delay elapsed
+  // Called by LightRun: the light of the last integration period, no waiting
   cb_luxSensorRead();
 }
 
+uint16_t SensorController::restartLuxIntegration() {
+  if (!I2CInitHelper::isReady(SC_LUX)) return 0;
+  // Shutdown and power-on drop the running integration; the next one starts after wake-up
+  veml7700.enable(false);
+  veml7700.enable(true);
+  return LUX_WAKE_MS + LUX_INTEGRATION_MS + LUX_MARGIN_MS;
+}
+
 void SensorController::beginSensor3() {
   // Placeholder: no hardware yet
   PL("[SensorController] Sensor3 (board) placeholder - no hardware");
@@ -1,8 +1,8 @@
 /**
  * @file SensorController.h
  * @brief Sensor initialization and reading interface for distance (VL53L1X) and lux (BH1750/VEML7700)
- * @version 260202A
- $12026-02-05
+ * @version 261016Y
+ * @date 2026-10-16
  */
 // lib/SensorController20251004/SensorController.h
 #pragma once
@@ -35,8 +35,11 @@ public:
   static void setAmbientLux(float value);
   static float ambientLux();
 
-  // RunManager triggers a single lux measurement
+  // Read the last completed lux integration (25 ms) into ambientLux(), without waiting
   static void performLuxMeasurement();
+  // Start a fresh integration; returns ms until performLuxMeasurement() covers only the time
+  // after this call (0 = sensor not ready)
+  static uint16_t restartLuxIntegration();
 
 private:
   static void cb_sensorRead();
@@ -1,11 +1,25 @@
 /**
  * @file TimerManager.cpp
  * @brief Non-blocking timer system implementation
- * @version 260212I
- * @date 2026-02-12
+ * @version 261016Z
+ * @date 2026-10-16
  *
- * Manages a pool of 60 software timers checked each loop() iteration.
- * When a timer's interval elapses, its callback is invoked.
+ * Manages a pool of MAX_TIMERS software timers. Active timers sit in a
+ * binary min-heap keyed by nextTime, so update() only touches timers that
+ * are due. A small open-addressing index maps (callback, token) to a slot,
+ * which makes create/cancel/restart/isActive independent of pool size.
+ * create()/restart() return a generation-counted TimerHandle; handle calls
+ * go straight to the slot and detect stale handles.
+ * nextDeadline()/idle() let loop() sleep until the earliest timer is due.
+ * With TIMER_PROFILE, each fire records run time and lateness per (cb, token).
+ * All deadlines use an injectable clock (default millis()) so host
+ * simulations can jump straight to the next deadline.
+ * Due timers dispatch by TimerPriority; BACKGROUND work has a time budget
+ * per update() so LED frames and fades keep their cadence.
+ * Timers created with slack are aligned to shared wakeup points.
+ * Web handlers (async_tcp task) create, restart and cancel timers while
+ * update() runs on the loop task: every access to the heap, the index and
+ * the free list is one critical section; callbacks run outside it.
  *
  * Features:
  * - Infinite, one-shot, and counted timers
@@ -28,153 +42,461 @@
 /// @brief Global TimerManager instance - preferred access method
 TimerManager timers;
 
-/// @brief Constructor - Timer struct defaults handle initialization
-TimerManager::TimerManager() {
-    // All Timer fields have in-class defaults (C++11)
-    // No explicit initialization needed
-}
+#define TIMER_LOCK()   portENTER_CRITICAL(&_mux)
+#define TIMER_UNLOCK() portEXIT_CRITICAL(&_mux)
 
-bool TimerManager::create(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth, uint8_t token) {
-    if (!cb) return false;
+static uint32_t systemClock() {
+    return millis();
+}
 
-    // Check for duplicate: same (callback, token) pair cannot exist twice
-    for (uint8_t i = 0; i < MAX_TIMERS; i++) {
-        if (timers[i].active && timers[i].cb == cb && timers[i].token == token) {
-            LOG_DEBUG("[TimerManager] creation failed - (cb, token) already in use\n");
-            return false;
-        }
+/// @brief Constructor - all slots free, identity index empty
+TimerManager::TimerManager() : _clock(systemClock) {
+    // Push in reverse so slot 0 is handed out first
+    for (TimerSlot i = MAX_TIMERS; i > 0; i--) {
+        freeSlots[freeCount++] = i - 1;
+    }
+    for (uint16_t i = 0; i < INDEX_SIZE; i++) {
+        index[i] = NO_SLOT;
     }
+}
 
-    // Find first free slot
-    for (uint8_t i = 0; i < MAX_TIMERS; i++) {
-        if (!timers[i].active) {
-            timers[i].active = true;
-            timers[i].cb = cb;
-            timers[i].token = token;
-            timers[i].interval = interval;
-            timers[i].nextTime = millis() + interval;
-            timers[i].repeat = repeat;
-            // Growth allowed for all timers; interval capped at MAX_GROWTH_INTERVAL_MS in update()
-            timers[i].growthMultiplier = growth;
-            return true;
-        }
+TimerHandle TimerManager::create(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth, uint8_t token,
+                                 TimerPriority priority, uint32_t slack) {
+    if (!cb) return TimerHandle{};
+    CreateResult result;
+    TIMER_LOCK();
+    const TimerHandle handle = createLocked(interval, repeat, cb, growth, token, priority, slack, result);
+    TIMER_UNLOCK();
+    logCreateResult(result);
+    return handle;
+}
+
+/// @brief create() with the lock held; the outcome is logged by the caller once unlocked
+TimerHandle TimerManager::createLocked(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth,
+                                       uint8_t token, TimerPriority priority, uint32_t slack, CreateResult &result) {
+    // Same (callback, token) pair cannot exist twice
+    if (findSlot(cb, token) != NO_SLOT) {
+        result = CreateResult::IN_USE;
+        return TimerHandle{};
+    }
+    if (freeCount == 0) {
+        result = CreateResult::POOL_FULL;
+        return TimerHandle{};
     }
 
-    LOG_WARN("[TimerManager] no free timers!\n");
-    return false;
+    const TimerSlot slot = freeSlots[--freeCount];
+    Timer &t = timers[slot];
+    t.active = true;
+    t.cb = cb;
+    t.token = token;
+    t.priority = priority;
+    t.slack = slack;
+#if TIMER_PROFILE
+    t.profile = profileFor(cb, token);
+#endif
+    indexInsert(slot);
+    armSlot(slot, interval, repeat, growth);
+
+    if (++_activeCount > _maxActiveTimers) _maxActiveTimers = _activeCount;
+    result = CreateResult::CREATED;
+    return TimerHandle{slot, t.generation};
+}
+
+// Logging stays out of the critical section
+void TimerManager::logCreateResult(CreateResult result) {
+    if (result == CreateResult::IN_USE) {
+        LOG_DEBUG("[TimerManager] creation failed - (cb, token) already in use\n");
+    } else if (result == CreateResult::POOL_FULL) {
+        LOG_WARN("[TimerManager] no free timers!\n");
+    }
 }
 
-/// @brief Deactivate timer and reset slot to defaults
 void TimerManager::cancel(TimerCallback cb, uint8_t token) {
     if (!cb) return;
-    for (uint8_t i = 0; i < MAX_TIMERS; i++) {
-        if (timers[i].active && timers[i].cb == cb && timers[i].token == token) {
-            timers[i].active = false;
-            timers[i].cb = nullptr;
-            timers[i].token = 1;
-            timers[i].growthMultiplier = 1.0f;
-            return;
-        }
+    TIMER_LOCK();
+    const TimerSlot slot = findSlot(cb, token);
+    if (slot != NO_SLOT) {
+        releaseSlot(slot);
+    }
+    TIMER_UNLOCK();
+}
+
+void TimerManager::cancel(TimerHandle handle) {
+    TIMER_LOCK();
+    if (isLive(handle)) {
+        releaseSlot(handle.slot);
+    }
+    TIMER_UNLOCK();
+}
+
+/// @brief Re-arm in place if (cb, token) is active, else create - always succeeds if slots available.
+/// In place the timer keeps its priority and slack (callers restarting with the defaults
+/// must not demote a REALTIME timer or drop its batching).
+TimerHandle TimerManager::restart(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth, uint8_t token,
+                                  TimerPriority priority, uint32_t slack) {
+    if (!cb) return TimerHandle{};
+    CreateResult result = CreateResult::CREATED;
+    TimerHandle handle;
+    TIMER_LOCK();
+    const TimerSlot slot = findSlot(cb, token);
+    if (slot == NO_SLOT) {
+        handle = createLocked(interval, repeat, cb, growth, token, priority, slack, result);
+    } else {
+        armSlot(slot, interval, repeat, growth);
+        handle = TimerHandle{slot, timers[slot].generation};
     }
+    TIMER_UNLOCK();
+    logCreateResult(result);
+    return handle;
 }
 
-/// @brief Cancel then create - always succeeds if slots available
-bool TimerManager::restart(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth, uint8_t token) {
-    cancel(cb, token);  // Safe even if timer doesn't exist
-    return create(interval, repeat, cb, growth, token);
+bool TimerManager::restart(TimerHandle handle, uint32_t interval, uint8_t repeat, float growth) {
+    TIMER_LOCK();
+    const bool live = isLive(handle);
+    if (live) armSlot(handle.slot, interval, repeat, growth);
+    TIMER_UNLOCK();
+    return live;
 }
 
 bool TimerManager::isActive(TimerCallback cb, uint8_t token) const {
     if (!cb) {
         return false;
     }
-    for (uint8_t i = 0; i < MAX_TIMERS; i++) {
-        if (timers[i].active && timers[i].cb == cb && timers[i].token == token) {
-            return true;
-        }
-    }
-    return false;
+    TIMER_LOCK();
+    const bool active = findSlot(cb, token) != NO_SLOT;
+    TIMER_UNLOCK();
+    return active;
+}
+
+bool TimerManager::isActive(TimerHandle handle) const {
+    TIMER_LOCK();
+    const bool live = isLive(handle);
+    TIMER_UNLOCK();
+    return live;
+}
+
+uint32_t TimerManager::nextDeadline(uint32_t cap) const {
+    TIMER_LOCK();
+    const bool empty = heapCount == 0;
+    const uint32_t nextTime = empty ? 0 : timers[heap[0]].nextTime;
+    TIMER_UNLOCK();
+    if (empty) return cap;
+    const int32_t remainingMs = static_cast<int32_t>(nextTime - now());
+    if (remainingMs <= 0) return 0;
+    return min(static_cast<uint32_t>(remainingMs), cap);
+}
+
+void TimerManager::setClock(TimerClock clock) {
+    _clock = clock ? clock : systemClock;
+}
+
+void TimerManager::idle(uint32_t maxMs) {
+    // A virtual clock only moves when its owner advances it; never block on it
+    if (_clock != systemClock) return;
+    const uint32_t waitMs = nextDeadline(maxMs);
+    if (waitMs == 0) return;
+    _idleTask = xTaskGetCurrentTaskHandle();
+    _idleCount++;
+    // Sleeps (IDLE task runs, CPU can clock down); wake() ends the wait early
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+}
+
+void TimerManager::wake() {
+    // The loop calling it is awake already; a pending notification would only cut its next sleep
+    if (_idleTask && xTaskGetCurrentTaskHandle() == _idleTask) return;
+    _wakeCount++;
+    if (_idleTask) xTaskNotifyGive(_idleTask);
 }
 
 void TimerManager::update() {
-    uint32_t now = millis();
-    for (uint8_t i = 0; i < MAX_TIMERS; i++) {
-        if (!timers[i].active) continue;
-        if ((int32_t)(now - timers[i].nextTime) >= 0) {
-            // run callback
-            TimerCallback cb = timers[i].cb;
-
-            // Make repeat count available to callback via remaining()
-            _remaining = timers[i].repeat;
-
-            // Buffer original values to detect if callback modified its own timer
-            // (callbacks may call cancel/restart/create on themselves)
-            const uint8_t originalRepeat = timers[i].repeat;
-            const uint32_t originalInterval = timers[i].interval;
-            const uint32_t originalNextTime = timers[i].nextTime;
-            const float originalGrowthMultiplier = timers[i].growthMultiplier;
-            const uint8_t originalToken = timers[i].token;
-
-            // Execute callback (may modify this timer via cancel/restart)
-            if (cb) cb();
-
-            // Reentrancy detection: if callback modified this timer, respect its changes
-            if (!timers[i].active) {
-                continue;  // Callback cancelled itself
-            }
-            if (timers[i].cb != cb) {
-                continue;  // Callback replaced itself with different callback
-            }
-            if (timers[i].token != originalToken) {
-                continue;  // Callback changed token (reused slot)
-            }
-            // If any parameter changed, callback called restart() with new values
-            if (timers[i].interval != originalInterval ||
-                timers[i].nextTime != originalNextTime ||
-                timers[i].repeat != originalRepeat ||
-                timers[i].growthMultiplier != originalGrowthMultiplier) {
+    const uint32_t now = this->now();
+
+    // Detach all due timers first, so each fires at most once per update()
+    // even if its rescheduled nextTime is still in the past.
+    TimerSlot due[MAX_TIMERS];
+    TimerSlot dueCount = 0;
+    TimerSlot order[MAX_TIMERS];
+    TimerSlot orderCount = 0;
+    // Held from here to the end, released only around each callback
+    TIMER_LOCK();
+    while (heapCount > 0 && static_cast<int32_t>(now - timers[heap[0]].nextTime) >= 0) {
+        const TimerSlot slot = heap[0];
+        heapRemove(slot);
+        due[dueCount++] = slot;
+    }
+
+    // Order by priority class; heap order keeps deadline order within a class
+    for (uint8_t cls = 0; cls <= static_cast<uint8_t>(TimerPriority::BACKGROUND); cls++) {
+        for (TimerSlot d = 0; d < dueCount; d++) {
+            if (static_cast<uint8_t>(timers[due[d]].priority) == cls) order[orderCount++] = due[d];
+        }
+    }
+
+    const uint32_t startUs = micros();
+    bool backgroundRan = false;
+
+    for (TimerSlot d = 0; d < orderCount; d++) {
+        const TimerSlot slot = order[d];
+        Timer &t = timers[slot];
+
+        // An earlier callback (or another task) cancelled this timer, or cancelled
+        // it and reused the slot for a new timer (which is back in the heap).
+        if (!t.active || t.heapPos != NO_SLOT) continue;
+
+        // Background budget: once spent, leave the rest due for the next update()
+        if (t.priority == TimerPriority::BACKGROUND) {
+            if (backgroundRan && micros() - startUs >= Globals::timerBackgroundBudgetUs) {
+                heapPush(slot);
+                _deferredCount++;
                 continue;
             }
+            backgroundRan = true;
+        }
 
-            // reschedule or finish using original parameters
-            if (originalRepeat == 1) {
-                // Last repeat - deactivate
-                timers[i].active = false;
-                timers[i].cb = nullptr;
-                timers[i].growthMultiplier = 1.0f;
-                timers[i].token = 1;
-            } else {
-                // Continuing timer: finite (repeat > 1) or infinite (repeat == 0)
-                if (originalRepeat > 1) {
-                    timers[i].repeat--;
-                }
-                // Apply growth multiplier if > 1.0
-                if (timers[i].growthMultiplier > 1.0f) {
-                    uint32_t newInterval = (uint32_t)(timers[i].interval * timers[i].growthMultiplier);
-                    timers[i].interval = min(newInterval, MAX_GROWTH_INTERVAL_MS);
-                }
-                timers[i].nextTime += timers[i].interval;
-            }
+        // Make repeat count available to callback via remaining()
+        _remaining = t.repeat;
+        const TimerCallback cb = t.cb;
+        const uint32_t generation = t.generation;
+#if TIMER_PROFILE
+        // Capture before the call: the callback may cancel or re-arm itself
+        const uint8_t profile = t.profile;
+        const uint32_t lateMs = this->now() - t.nextTime;
+#endif
+        TIMER_UNLOCK();
+
+#if TIMER_PROFILE
+        const uint32_t cbStartUs = micros();
+#endif
+
+        // Execute callback (may modify this timer via cancel/restart)
+        cb();
+
+#if TIMER_PROFILE
+        recordProfile(profile, micros() - cbStartUs, lateMs);
+#endif
+
+        TIMER_LOCK();
+        // Reentrancy detection: cancel() frees the slot, restart()/create()
+        // puts the timer back in the heap. Either way, respect the change.
+        if (!t.active || t.generation != generation || t.heapPos != NO_SLOT) continue;
+
+        // reschedule or finish using original parameters
+        if (t.repeat == 1) {
+            // Last repeat - deactivate
+            releaseSlot(slot);
+            continue;
+        }
+        // Continuing timer: finite (repeat > 1) or infinite (repeat == 0)
+        if (t.repeat > 1) {
+            t.repeat--;
         }
+        // Apply growth multiplier if > 1.0
+        if (t.growthMultiplier > 1.0f) {
+            uint32_t newInterval = static_cast<uint32_t>(t.interval * t.growthMultiplier);
+            t.interval = min(newInterval, MAX_GROWTH_INTERVAL_MS);
+        }
+        t.dueTime += t.interval;
+        t.nextTime = alignDeadline(t.dueTime, t.slack);
+        heapPush(slot);
+    }
+    TIMER_UNLOCK();
+}
+
+// ===================================================
+// Slot bookkeeping
+// ===================================================
+
+bool TimerManager::isLive(TimerHandle handle) const {
+    return handle.slot < MAX_TIMERS &&
+           timers[handle.slot].active &&
+           timers[handle.slot].generation == handle.generation;
+}
+
+/// @brief (Re)load timing fields of an allocated slot and (re)position it in the heap
+void TimerManager::armSlot(TimerSlot slot, uint32_t interval, uint8_t repeat, float growth) {
+    Timer &t = timers[slot];
+    if (t.heapPos != NO_SLOT) {
+        heapRemove(slot);
     }
+    t.interval = interval;
+    t.dueTime = now() + interval;
+    t.nextTime = alignDeadline(t.dueTime, t.slack);
+    t.repeat = repeat;
+    // Growth allowed for all timers; interval capped at MAX_GROWTH_INTERVAL_MS in update()
+    t.growthMultiplier = growth;
+    heapPush(slot);
 }
 
-uint8_t TimerManager::getActiveCount() const {
-    uint8_t count = 0;
-    for (uint8_t i = 0; i < MAX_TIMERS; i++) {
-        if (timers[i].active) count++;
+/// @brief Deadline for a fire due at dueTime that may slip by up to slack ms.
+/// Joins the earliest slack-timer deadline in [dueTime, dueTime + slack]; otherwise
+/// rounds up to a multiple of slack, so later slack timers find it. Linear in the
+/// heap size, paid only when a slack timer is (re)armed.
+uint32_t TimerManager::alignDeadline(uint32_t dueTime, uint32_t slack) {
+    if (slack == 0) return dueTime;
+    uint32_t bestOffset = UINT32_MAX;
+    for (TimerSlot i = 0; i < heapCount; i++) {
+        const Timer &other = timers[heap[i]];
+        if (other.slack == 0) continue;  // Exact timers (LED frames etc.) are no batching anchor
+        const uint32_t offset = other.nextTime - dueTime;
+        if (offset <= slack && offset < bestOffset) bestOffset = offset;
     }
-    if (count > _maxActiveTimers) const_cast<TimerManager*>(this)->_maxActiveTimers = count;
-    return count;
+    if (bestOffset != UINT32_MAX) {
+        _coalescedCount++;
+        return dueTime + bestOffset;
+    }
+    return dueTime + (slack - dueTime % slack) % slack;
 }
 
+/// @brief Deactivate timer, drop it from heap and index, reset slot to defaults
+void TimerManager::releaseSlot(TimerSlot slot) {
+    Timer &t = timers[slot];
+    indexErase(slot);
+    if (t.heapPos != NO_SLOT) {
+        heapRemove(slot);
+    }
+    t.active = false;
+    t.cb = nullptr;
+    t.token = 1;
+    t.growthMultiplier = 1.0f;
+    t.slack = 0;
+    t.generation++;  // Invalidate outstanding handles
+    freeSlots[freeCount++] = slot;
+    _activeCount--;
+}
+
+// ===================================================
+// (callback, token) identity index
+// ===================================================
+
+uint16_t TimerManager::indexHome(TimerCallback cb, uint8_t token) const {
+    // Fibonacci hashing; low pointer bits are mostly alignment, so mix before masking
+    const uint32_t key = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(cb)) ^
+                         (static_cast<uint32_t>(token) << 24);
+    return static_cast<uint16_t>((key * 2654435769u) >> 16) & (INDEX_SIZE - 1);
+}
+
+TimerSlot TimerManager::findSlot(TimerCallback cb, uint8_t token) const {
+    for (uint16_t i = indexHome(cb, token);; i = (i + 1) & (INDEX_SIZE - 1)) {
+        const TimerSlot slot = index[i];
+        if (slot == NO_SLOT) return NO_SLOT;
+        if (timers[slot].cb == cb && timers[slot].token == token) return slot;
+    }
+}
+
+void TimerManager::indexInsert(TimerSlot slot) {
+    uint16_t i = indexHome(timers[slot].cb, timers[slot].token);
+    while (index[i] != NO_SLOT) {
+        i = (i + 1) & (INDEX_SIZE - 1);
+    }
+    index[i] = slot;
+}
+
+/// @brief Remove slot from index with backward-shift deletion (no tombstones)
+void TimerManager::indexErase(TimerSlot slot) {
+    uint16_t hole = indexHome(timers[slot].cb, timers[slot].token);
+    while (index[hole] != slot) {
+        hole = (hole + 1) & (INDEX_SIZE - 1);
+    }
+    for (uint16_t i = (hole + 1) & (INDEX_SIZE - 1); index[i] != NO_SLOT; i = (i + 1) & (INDEX_SIZE - 1)) {
+        const uint16_t home = indexHome(timers[index[i]].cb, timers[index[i]].token);
+        // Move entry into the hole unless its home lies cyclically in (hole, i]
+        const uint16_t distHole = (i - hole) & (INDEX_SIZE - 1);
+        const uint16_t distHome = (i - home) & (INDEX_SIZE - 1);
+        if (distHome >= distHole) {
+            index[hole] = index[i];
+            hole = i;
+        }
+    }
+    index[hole] = NO_SLOT;
+}
+
+// ===================================================
+// Deadline heap
+// ===================================================
+
+/// @brief Wrap-safe deadline order (millis() rollover)
+bool TimerManager::heapBefore(TimerSlot a, TimerSlot b) const {
+    return static_cast<int32_t>(timers[a].nextTime - timers[b].nextTime) < 0;
+}
+
+void TimerManager::heapPlace(TimerSlot pos, TimerSlot slot) {
+    heap[pos] = slot;
+    timers[slot].heapPos = pos;
+}
+
+void TimerManager::heapPush(TimerSlot slot) {
+    const TimerSlot pos = heapCount++;
+    heapPlace(pos, slot);
+    heapSiftUp(pos);
+}
+
+void TimerManager::heapRemove(TimerSlot slot) {
+    const TimerSlot pos = timers[slot].heapPos;
+    timers[slot].heapPos = NO_SLOT;
+    const TimerSlot last = heap[--heapCount];
+    if (pos == heapCount) return;
+    heapPlace(pos, last);
+    heapSiftUp(pos);
+    heapSiftDown(timers[last].heapPos);
+}
+
+void TimerManager::heapSiftUp(TimerSlot pos) {
+    const TimerSlot slot = heap[pos];
+    while (pos > 0) {
+        const TimerSlot parent = (pos - 1) / 2;
+        if (!heapBefore(slot, heap[parent])) break;
+        heapPlace(pos, heap[parent]);
+        pos = parent;
+    }
+    heapPlace(pos, slot);
+}
+
+void TimerManager::heapSiftDown(TimerSlot pos) {
+    const TimerSlot slot = heap[pos];
+    for (;;) {
+        uint16_t child = 2 * pos + 1;
+        if (child >= heapCount) break;
+        if (child + 1 < heapCount && heapBefore(heap[child + 1], heap[child])) child++;
+        if (!heapBefore(heap[child], slot)) break;
+        heapPlace(pos, heap[child]);
+        pos = static_cast<TimerSlot>(child);
+    }
+    heapPlace(pos, slot);
+}
+
+// ===================================================
+// Profiler
+// ===================================================
+#if TIMER_PROFILE
+/// @brief Find or add the profile entry for (cb, token); runs at create() only
+uint8_t TimerManager::profileFor(TimerCallback cb, uint8_t token) {
+    for (uint8_t i = 0; i < _profileCount; i++) {
+        if (_profiles[i].cb == cb && _profiles[i].token == token) return i;
+    }
+    if (_profileCount >= MAX_TIMER_PROFILES) return NO_PROFILE;
+    _profiles[_profileCount].cb = cb;
+    _profiles[_profileCount].token = token;
+    return _profileCount++;
+}
+
+void TimerManager::recordProfile(uint8_t profile, uint32_t runUs, uint32_t lateMs) {
+    if (profile == NO_PROFILE) return;
+    Profile &p = _profiles[profile];
+    p.calls++;
+    p.totalUs += runUs;
+    if (runUs > p.maxUs) p.maxUs = runUs;
+    p.totalLateMs += lateMs;
+    if (lateMs > p.maxLateMs) p.maxLateMs = lateMs;
+}
+#endif
+
 // ===================================================
 // Diagnostics
 // ===================================================
 void TimerManager::showAvailableTimers(bool showAlways) {
 #if SHOW_TIMER_STATUS
-    static uint8_t maxUsed = 0;
-    uint8_t usedCount = getActiveCount();
+    static TimerSlot maxUsed = 0;
+    TimerSlot usedCount = getActiveCount();
 
     if (usedCount > maxUsed) {
         maxUsed = usedCount;
@@ -187,4 +509,4 @@ void TimerManager::showAvailableTimers(bool showAlways) {
 #else
     (void)showAlways;  // Suppress unused parameter warning
 #endif
-}
\ No newline at end of file
+}
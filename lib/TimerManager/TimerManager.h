@@ -1,8 +1,8 @@
 /**
  * @file TimerManager.h
  * @brief Central non-blocking timer pool using callbacks (replaces scattered millis()/delay()).
- * @version 260212I
- * @date 2026-02-12
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #pragma once
 #include <Arduino.h>
@@ -11,25 +11,90 @@
 // Type alias for timer callbacks (plain function pointer).
 typedef void (*TimerCallback)();
 
+// Millisecond clock source for TimerManager (default wraps millis()).
+typedef uint32_t (*TimerClock)();
+
+// Dispatch class: due timers run REALTIME first, then INTERACTIVE, then BACKGROUND.
+// BACKGROUND work is deferred once an update() exceeds Globals::timerBackgroundBudgetUs.
+enum class TimerPriority : uint8_t {
+    REALTIME,       ///< LED frames, audio fades: keep cadence
+    INTERACTIVE,    ///< Default: run logic, web jobs, sensors
+    BACKGROUND      ///< SD/network health, refresh, status logging: deferrable
+};
+
 // Helper macro for callbacks declared inside classes/modules.
 #define cb_type static void
 
+/// Pool slot index: one byte for the firmware's pool; wider only for host benchmark pools
+#if MAX_TIMERS < 0xFF
+typedef uint8_t TimerSlot;
+#else
+typedef uint16_t TimerSlot;
+#endif
+
+/// Smallest power of two >= n (sizes the TimerManager identity index)
+constexpr uint16_t timerIndexSize(uint16_t n, uint16_t size = 1) {
+    return size >= n ? size : timerIndexSize(n, static_cast<uint16_t>(size * 2));
+}
+
+/**
+ * @brief Stable reference to one timer instance, returned by create()/restart().
+ *
+ * Holds the slot plus the slot's generation at creation time. When the timer
+ * finishes or is cancelled the slot generation moves on, so a stale handle
+ * never aliases a later timer in the same slot.
+ * Converts to true when creation succeeded; use timers.isActive(handle) for liveness.
+ */
+struct TimerHandle {
+    TimerSlot slot = static_cast<TimerSlot>(~0u);  ///< Pool slot (all ones = no timer)
+    uint32_t generation = 0;       ///< Slot generation when the handle was issued
+    explicit operator bool() const { return slot != static_cast<TimerSlot>(~0u); }
+};
+
 class TimerManager {
 public:
     /// @brief Default constructor. Prefer using global `timers` instance.
     TimerManager();
 
+    /// Marker for "no slot" in heap positions and the identity index
+    static constexpr TimerSlot NO_SLOT = static_cast<TimerSlot>(~0u);
+
     struct Timer {
         bool active = false;           ///< Timer slot in use?
         TimerCallback cb = nullptr;    ///< Callback function pointer
         uint8_t token = 1;             ///< Identity token (allows multiple timers per callback)
         uint32_t interval = 0;         ///< Current interval in ms (may grow if growthMultiplier > 1.0)
-        uint32_t nextTime = 0;         ///< Absolute millis() timestamp for next fire
+        uint32_t nextTime = 0;         ///< Absolute millis() timestamp for next fire (aligned when slack > 0)
+        uint32_t dueTime = 0;          ///< Unaligned deadline; period stays exact under slack
+        uint32_t slack = 0;            ///< Allowed delay (ms) to share a wakeup with other slack timers
         uint8_t repeat = 0;            ///< Remaining fires: 0=infinite, 1=last, >1=countdown
         float growthMultiplier = 1.0f; ///< Interval multiplier per fire (1.0=constant, >1.0=backoff)
+        TimerSlot heapPos = NO_SLOT;   ///< Position in the deadline heap (NO_SLOT while firing or free)
+        uint32_t generation = 0;       ///< Bumped on every release; validates TimerHandle
+        TimerPriority priority = TimerPriority::INTERACTIVE; ///< Dispatch class
+#if TIMER_PROFILE
+        uint8_t profile = NO_PROFILE;  ///< Index into profile table (NO_PROFILE = table full)
+#endif
+    };
+
+#if TIMER_PROFILE
+    static constexpr uint8_t NO_PROFILE = 0xFF;
+    static_assert(MAX_TIMER_PROFILES < NO_PROFILE, "MAX_TIMER_PROFILES must fit in uint8_t profile indices");
+
+    /// Per-(cb, token) statistics; survives cancel/restart of the timer
+    struct Profile {
+        TimerCallback cb = nullptr;    ///< Callback function pointer
+        uint8_t token = 1;             ///< Identity token
+        uint32_t calls = 0;            ///< Number of fires
+        uint64_t totalUs = 0;          ///< Summed callback run time
+        uint32_t maxUs = 0;            ///< Longest single callback run
+        uint64_t totalLateMs = 0;      ///< Summed fire lateness (millis() - nextTime)
+        uint32_t maxLateMs = 0;        ///< Worst fire lateness
     };
+#endif
 
     // MAX_TIMERS defined in Globals.h
+    static_assert(MAX_TIMERS < NO_SLOT, "MAX_TIMERS must fit in TimerSlot indices");
 
     /**
      * @brief Create a timer.
@@ -39,16 +104,26 @@ public:
      * @param cb         Callback function.
      * @param growth     Interval multiplier per fire (1.0 = constant).
      * @param token      Timer identity token (default 1). Use different tokens for multiple timers with same callback.
+     * @param priority   Dispatch class when several timers are due together.
+     * @param slack      Max delay (ms) the timer tolerates per fire (0 = exact). Slack timers fire
+     *                   together with another slack timer's deadline inside the window, else on a
+     *                   slack-sized grid, so periodic housekeeping shares wakeups.
      *
-     * @return true on success, false if no slot is available or (cb, token) already in use.
+     * @return Handle to the new timer; empty (false) if no slot is available or (cb, token) already in use.
      */
-    bool create(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth = 1.0f, uint8_t token = 1);
+    TimerHandle create(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth = 1.0f, uint8_t token = 1,
+                       TimerPriority priority = TimerPriority::INTERACTIVE, uint32_t slack = 0);
 
     /**
      * @brief Cancel a timer by (callback, token) identity.
      */
     void cancel(TimerCallback cb, uint8_t token = 1);
 
+    /**
+     * @brief Cancel a timer by handle (direct slot access). Stale handles are ignored.
+     */
+    void cancel(TimerHandle handle);
+
     /**
      * @brief Restart a timer: cancels existing timer (if any) and creates new one.
      *
@@ -57,16 +132,33 @@ public:
      * - Changing interval/repeat of an active timer
      * - Sequence callbacks that reuse the same function with different timings
      *
-     * @return true on success, false if no slot available.
+     * An active (cb, token) timer is re-armed in its own slot, so handles to it stay valid,
+     * and keeps its priority and slack like restart(handle, ...); those two arguments only
+     * apply when a new timer is created. Cancel first to change them.
+     *
+     * @return Handle to the timer; empty (false) if no slot available.
+     */
+    TimerHandle restart(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth = 1.0f, uint8_t token = 1,
+                        TimerPriority priority = TimerPriority::INTERACTIVE, uint32_t slack = 0);
+
+    /**
+     * @brief Re-arm a live timer by handle with new interval/repeat (direct slot access). Keeps priority and slack.
+     * @return false if the handle is stale (timer finished or cancelled); nothing changes then.
      */
-    bool restart(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth = 1.0f, uint8_t token = 1);
+    bool restart(TimerHandle handle, uint32_t interval, uint8_t repeat, float growth = 1.0f);
 
     /**
-     * @brief Update all timers.
-     * Must be called once per loop iteration.
+     * @brief Fire all due timers.
+     * Must be called once per loop iteration. Cost scales with the number of
+     * due timers, not with MAX_TIMERS. Due timers fire by priority class, in
+     * deadline order within a class, and each fires at most once per call.
+     * BACKGROUND timers beyond the per-update budget stay due for the next call
+     * (at least one BACKGROUND callback runs per call, so none starve).
      *
      * @note Callbacks are allowed to cancel or reconfigure timers.
      *       TimerManager detects such changes and will not override them.
+     * @note Loop task only. create/restart/cancel/isActive may also be called from
+     *       other tasks (web handlers); they share a critical section with update().
      */
     void update();
 
@@ -75,6 +167,71 @@ public:
      */
     bool isActive(TimerCallback cb, uint8_t token = 1) const;
 
+    /**
+     * @brief Check whether the timer behind this handle is still active.
+     */
+    bool isActive(TimerHandle handle) const;
+
+    /**
+     * @brief Milliseconds until the earliest active timer is due (0 = due now).
+     * @param cap Upper bound; also returned when no timer is active.
+     */
+    uint32_t nextDeadline(uint32_t cap = UINT32_MAX) const;
+
+    /**
+     * @brief Idle mode: block the calling task until the next deadline, a wake() or maxMs.
+     * Returns immediately when a timer is already due. Call from loop() only, after update().
+     */
+    void idle(uint32_t maxMs);
+
+    /**
+     * @brief End an idle() wait early: call after handing work to the loop from another task
+     * (web request armed a timer, audio playback started). No-op from the loop task itself.
+     */
+    void wake();
+
+    /**
+     * @brief Number of idle() calls that actually blocked (loop sleeps since boot).
+     */
+    uint32_t getIdleCount() const { return _idleCount; }
+
+    /**
+     * @brief Number of wake() calls from outside the loop task since boot.
+     */
+    uint32_t getWakeCount() const { return _wakeCount; }
+
+    /**
+     * @brief Number of BACKGROUND fires postponed by the per-update budget since boot.
+     */
+    uint32_t getDeferredCount() const { return _deferredCount; }
+
+    /**
+     * @brief Number of slack timer fires scheduled onto an existing wakeup (wakeups saved) since boot.
+     */
+    uint32_t getCoalescedCount() const { return _coalescedCount; }
+
+    /**
+     * @brief Replace the millisecond clock (host simulation with a virtual clock).
+     * Call before any timer is created; nullptr restores millis().
+     * A simulation advances its clock by nextDeadline() and calls update(),
+     * so a day of timer-driven logic runs without waiting.
+     */
+    void setClock(TimerClock clock);
+
+    /**
+     * @brief Current time of the TimerManager clock in ms (millis() unless a virtual clock is set).
+     */
+    uint32_t now() const { return _clock(); }
+
+#if TIMER_PROFILE
+    /**
+     * @brief Profiler table access (TIMER_PROFILE builds only).
+     * Entries are never removed; one per (cb, token) seen since boot.
+     */
+    uint8_t getProfileCount() const { return _profileCount; }
+    const Profile &getProfile(uint8_t i) const { return _profiles[i]; }
+#endif
+
     /**
      * @brief Remaining repeat count of the currently executing callback.
      * Set by update() before each callback invocation. Only valid inside a timer callback.
@@ -85,12 +242,12 @@ public:
     /**
      * @brief Get the number of active timers.
      */
-    uint8_t getActiveCount() const;
+    TimerSlot getActiveCount() const { return _activeCount; }
 
     /**
      * @brief Get max number of simultaneously active timers since boot.
      */
-    uint8_t getMaxActiveTimers() const { return _maxActiveTimers; }
+    TimerSlot getMaxActiveTimers() const { return _maxActiveTimers; }
 
     /**
      * @brief Diagnostics: report current and max timer usage.
@@ -100,11 +257,62 @@ public:
     void showAvailableTimers(bool showAlways);
 
 private:
+    enum class CreateResult : uint8_t { CREATED, IN_USE, POOL_FULL };
+
+    /// Identity index size: power of two, at least twice MAX_TIMERS (load factor <= 0.5)
+    static constexpr uint16_t INDEX_SIZE = timerIndexSize(2 * MAX_TIMERS);
+
+    // Callers of the helpers below hold _mux
+    TimerHandle createLocked(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth, uint8_t token,
+                             TimerPriority priority, uint32_t slack, CreateResult &result);
+    static void logCreateResult(CreateResult result);
+
+    TimerSlot findSlot(TimerCallback cb, uint8_t token) const;
+    uint16_t indexHome(TimerCallback cb, uint8_t token) const;
+    void indexInsert(TimerSlot slot);
+    void indexErase(TimerSlot slot);
+
+    bool heapBefore(TimerSlot a, TimerSlot b) const;
+    void heapPush(TimerSlot slot);
+    void heapRemove(TimerSlot slot);
+    void heapSiftUp(TimerSlot pos);
+    void heapSiftDown(TimerSlot pos);
+    void heapPlace(TimerSlot pos, TimerSlot slot);
+
+    bool isLive(TimerHandle handle) const;
+    void armSlot(TimerSlot slot, uint32_t interval, uint8_t repeat, float growth);
+    uint32_t alignDeadline(uint32_t dueTime, uint32_t slack);
+    void releaseSlot(TimerSlot slot);
+
+#if TIMER_PROFILE
+    uint8_t profileFor(TimerCallback cb, uint8_t token);
+    void recordProfile(uint8_t profile, uint32_t runUs, uint32_t lateMs);
+
+    Profile _profiles[MAX_TIMER_PROFILES];
+    uint8_t _profileCount = 0;
+#endif
+
+    /// Guards timers[], the heap, the index and the free list: web handlers on the async_tcp
+    /// task create/restart/cancel while update() runs on the loop task
+    mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+
     Timer timers[MAX_TIMERS];
+    TimerSlot heap[MAX_TIMERS];        ///< Active slots, min-heap on nextTime
+    TimerSlot heapCount = 0;
+    TimerSlot freeSlots[MAX_TIMERS];   ///< Stack of unused slots
+    TimerSlot freeCount = 0;
+    TimerSlot index[INDEX_SIZE];       ///< (cb, token) → slot, open addressing with linear probing
+    TimerSlot _activeCount = 0;
     uint8_t _remaining = 0;   ///< Set before each callback invocation
-    uint8_t _maxActiveTimers = 0;   ///< Max simultaneously active timers since boot
+    TimerSlot _maxActiveTimers = 0; ///< Max simultaneously active timers since boot
+    TimerClock _clock;              ///< Time source for all deadlines
+    TaskHandle_t _idleTask = nullptr;  ///< Task blocked in idle(); target of wake()
+    uint32_t _idleCount = 0;        ///< idle() calls that blocked
+    uint32_t _wakeCount = 0;        ///< wake() calls from other tasks
+    uint32_t _deferredCount = 0;    ///< BACKGROUND fires postponed by budget
+    uint32_t _coalescedCount = 0;   ///< Slack fires that joined an existing wakeup
 };
 
 /// @brief Global TimerManager instance - preferred access method
 /// @note Defined in TimerManager.cpp. Preferred access method.
-extern TimerManager timers;
\ No newline at end of file
+extern TimerManager timers;
@@ -1,8 +1,8 @@
 /**
  * @file HealthRoutes.cpp
  * @brief Health API endpoint routes
- * @version 260219A
- * @date 2026-02-19
+ * @version 261016Z
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include "HealthRoutes.h"
@@ -13,6 +13,9 @@
 #include "ContextController.h"
 #include "Calendar/CalendarRun.h"
 #include "TodayState.h"
+#include "LightController.h"
+#include "LightPower.h"
+#include "BakedShow.h"
 #include <ESP.h>
 
 namespace HealthRoutes {
@@ -56,6 +59,24 @@ void routeHealth(AsyncWebServerRequest *request) {
     json += ",\"heapMin\":" + String(ESP.getMinFreeHeap() / 1024);
     json += ",\"heapBlock\":" + String(ESP.getMaxAllocHeap() / 1024);
 
+    // LED frames sent vs. skipped as unchanged; outputs between frames for temporal dithering
+    json += ",\"ledFrames\":" + String(getFramesShown());
+    json += ",\"ledFramesSkipped\":" + String(getFramesSkipped());
+    json += ",\"ledFramesDithered\":" + String(getFramesDithered());
+    json += ",\"ledFrameMs\":" + String(getFrameIntervalMs());
+    json += ",\"ledRenderUs\":" + String(getRenderUsAvg());
+    json += ",\"ledRenderUsMax\":" + String(getRenderUsMax());
+    // LED current estimate of the last shown frame; power cap 255 = not limiting
+    json += ",\"ledMilliamps\":" + String(getLedMilliwatts() / LightPower::MODEL_VOLTS);
+    json += ",\"ledPowerCap\":" + String(getLedPowerCap());
+    json += ",\"ledZones\":" + String(getLightZoneCount());
+    // Baked show streaming from SD (0 = none): read rate, slowest chunk read, frames not ready in time
+    const BakedShow::Stats baked = BakedShow::stats();
+    json += ",\"bakedShow\":" + String(BakedShow::activeId());
+    json += ",\"bakedKBps\":" + String(baked.activeMs ? baked.bytesRead / baked.activeMs : 0);
+    json += ",\"bakedReadUsMax\":" + String(baked.readUsMax);
+    json += ",\"bakedUnderruns\":" + String(baked.underruns);
+
     TodayState today;
     if (calendarRun.todayRead(today) && today.entry.valid) {
         char dateBuf[6]; // "dd-mm\0"
@@ -84,6 +105,45 @@ void routeHealth(AsyncWebServerRequest *request) {
     request->send(200, "application/json", json);
 }
 
+// Timer profiler table (TIMER_PROFILE builds). Callbacks are reported by address;
+// tools/resolve_timer_symbols.py maps them to names via the build's firmware.map.
+void routeHealthTimers(AsyncWebServerRequest *request) {
+    String json = "{";
+    json += "\"timers\":" + String(timers.getActiveCount());
+    json += ",\"maxActiveTimers\":" + String(timers.getMaxActiveTimers());
+    json += ",\"maxTimers\":" + String(MAX_TIMERS);
+    json += ",\"deferred\":" + String(timers.getDeferredCount());
+    json += ",\"coalesced\":" + String(timers.getCoalescedCount());
+#if TIMER_PROFILE
+    json += ",\"profiling\":true,\"profiles\":[";
+    const uint8_t count = timers.getProfileCount();
+    for (uint8_t i = 0; i < count; i++) {
+        const TimerManager::Profile &p = timers.getProfile(i);
+        const uint32_t calls = p.calls;
+        char buf[192];
+        snprintf(buf, sizeof(buf),
+                 "%s{\"cb\":\"0x%08lx\",\"token\":%u,\"calls\":%lu,\"totalMs\":%lu,"
+                 "\"avgUs\":%lu,\"maxUs\":%lu,\"avgLateMs\":%lu,\"maxLateMs\":%lu}",
+                 i ? "," : "",
+                 static_cast<unsigned long>(reinterpret_cast<uintptr_t>(p.cb)),
+                 static_cast<unsigned>(p.token),
+                 static_cast<unsigned long>(calls),
+                 static_cast<unsigned long>(p.totalUs / 1000U),
+                 static_cast<unsigned long>(calls ? p.totalUs / calls : 0),
+                 static_cast<unsigned long>(p.maxUs),
+                 static_cast<unsigned long>(calls ? p.totalLateMs / calls : 0),
+                 static_cast<unsigned long>(p.maxLateMs));
+        json += buf;
+    }
+    json += "]";
+#else
+    json += ",\"profiling\":false";
+#endif
+    json += "}";
+
+    request->send(200, "application/json", json);
+}
+
 void cb_restart() {
     ESP.restart();
 }
@@ -122,6 +182,8 @@ void routeWifiConfig(AsyncWebServerRequest *request) {
 }
 
 void attachRoutes(AsyncWebServer &server) {
+    // Register before /api/health: AsyncWebServer also matches "/api/health/..." on that prefix
+    server.on("/api/health/timers", HTTP_GET, routeHealthTimers);
     server.on("/api/health", HTTP_GET, routeHealth);
     server.on("/api/restart", HTTP_POST, routeRestart);
     server.on("/api/wifi/config", HTTP_POST, routeWifiConfig);
@@ -1,8 +1,8 @@
 /**
  * @file HealthRoutes.h
  * @brief Health API endpoint routes
- * @version 260202A
- $12026-02-05
+ * @version 261016D
+ * @date 2026-10-16
  */
 #pragma once
 
@@ -11,6 +11,7 @@
 namespace HealthRoutes {
 
 void routeHealth(AsyncWebServerRequest *request);
+void routeHealthTimers(AsyncWebServerRequest *request);
 void attachRoutes(AsyncWebServer &server);
 
 } // namespace HealthRoutes
\ No newline at end of file
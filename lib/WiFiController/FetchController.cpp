@@ -1,8 +1,8 @@
 /**
  * @file FetchController.cpp
  * @brief HTTP fetch for weather/sunrise APIs and NTP time
- * @version 260214A
- * @date 2026-02-14
+ * @version 261016F
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 #include "FetchController.h"
@@ -225,7 +225,7 @@ static void cb_fetchWeather() {
         weatherFetched = true;
         // Switch from boot retries to periodic refresh
         timers.cancel(cb_fetchWeather);
-        timers.create(Globals::weatherRefreshIntervalMs, 0, cb_fetchWeather);
+        timers.create(Globals::weatherRefreshIntervalMs, 0, cb_fetchWeather, 1.0f, 1, TimerPriority::BACKGROUND);
     } else if (DEBUG_FETCH) {
         PF("[Fetch] Weather updated: min=%.1f max=%.1f\n", tMin, tMax);
     }
@@ -513,7 +513,7 @@ bool bootFetchController() {
     weatherFetched = false;
     timers.create(Globals::weatherBootstrapIntervalMs, Globals::wifiRetryCount, cb_fetchWeather, Globals::wifiRetryGrowth);
     // Sunrise/sunset fetch timer (starts after NTP success)
-    timers.create(Globals::sunRefreshIntervalMs, 0, cb_fetchSunrise);
+    timers.create(Globals::sunRefreshIntervalMs, 0, cb_fetchSunrise, 1.0f, 1, TimerPriority::BACKGROUND);
 
     return true;
 }
@@ -1,8 +1,8 @@
 /**
  * @file NasBackup.cpp
  * @brief Push pattern/color CSVs to NAS csv_server.py after save
- * @version 260220B
- * @date 2026-02-20
+ * @version 261016G
+ * @date 2026-10-16
  *
  * Safe push design:
  *   requestPush(filename) sets a pending bool and starts a repeating timer.
@@ -162,7 +162,7 @@ void NasBackup::requestPush(const char* filename) {
         return;
     }
     // Start repeating timer if not already running
-    timers.create(PUSH_INTERVAL_MS, 0, cb_pushToNas);
+    timers.create(PUSH_INTERVAL_MS, 0, cb_pushToNas, 1.0f, 1, TimerPriority::BACKGROUND);
 }
 
 /// Probe NAS health. Called from infinite repeating timer (every 2 min).
@@ -194,5 +194,6 @@ void NasBackup::checkHealth() {
 
 /// Start the infinite health check timer. Called once from WiFiBoot.
 void NasBackup::startHealthTimer() {
-    timers.create(HEALTH_INTERVAL_MS, 0, cb_checkNasHealth);
+    timers.create(HEALTH_INTERVAL_MS, 0, cb_checkNasHealth, 1.0f, 1, TimerPriority::BACKGROUND,
+                  HEALTH_INTERVAL_MS / 4);
 }
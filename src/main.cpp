@@ -1,8 +1,8 @@
 /**
  * @file main.cpp
  * @brief Kwal ESP32 Firmware - Main entry point
- * @version 260202A
- * @date 2026-02-02
+ * @version 261016C
+ * @date 2026-10-16
  */
 #include <Arduino.h>
 
@@ -33,9 +33,13 @@ void setup()
  * @brief Arduino main loop - runs continuously
  * Updates the timer system and RunManager each iteration.
  * All timing is handled by TimerManager callbacks, not by delays.
+ * Idle mode: when nothing needs pumping, sleep until the next timer is due.
  */
 void loop()
 {
     timers.update();
     RunManager::update();
-}
\ No newline at end of file
+    if (RunManager::canIdle()) {
+        timers.idle(Globals::loopIdleMaxMs);
+    }
+}
@@ -0,0 +1,300 @@
+"""Bake a light show offline into a baked show file (.lsb) streamed from SD.
+
+Effects too heavy to render per frame on the ESP32 are rendered here for every
+LED of ledmap.bin and stored as RGB frames in LED index order, each frame
+delta-coded against the previous one (format: lib/LightController/BakedShow.h).
+A pattern plays the file through the `baked` column of light_patterns.csv; the
+firmware applies color correction and the brightness ceiling at play time.
+
+Effects:
+    sparks   bursts of particles flying out from the center, fading as they go
+    sweep    an image (8-bit PNG) scrolled across the dome once per loop
+
+Usage:
+    python tools/bake_show.py sparks -o sdroot/light_shows/1.lsb --seconds 20
+    python tools/bake_show.py sweep --image sweep.png -o sdroot/light_shows/2.lsb --fps 20
+    python tools/bake_show.py --info sdroot/light_shows/1.lsb
+"""
+import argparse, math, os, random, struct, sys, zlib
+
+NUM_LEDS = 160
+FRAME_BYTES = NUM_LEDS * 3
+MAGIC = b"LSB1"
+HEADER = struct.Struct("<4sHBBII")   # magic, ledCount, fps, reserved, frameCount, mapHash
+CHUNK_SIZE = 512                     # BakedShow::CHUNK_SIZE
+CHUNKS_WITH_AUDIO = 2                # BakedShow::CHUNKS_WITH_AUDIO, per repaint tick
+
+
+# ===== LED map =====
+
+def load_ledmap(path):
+    """LED positions and the map hash; the firmware's ring fallback (hash 0) without a map."""
+    if os.path.exists(path):
+        with open(path, "rb") as f:
+            data = f.read(NUM_LEDS * 8)
+        if len(data) != NUM_LEDS * 8:
+            sys.exit(f"{path}: {len(data) // 8} of {NUM_LEDS} LEDs")
+        pos = [struct.unpack_from("<ff", data, i * 8) for i in range(NUM_LEDS)]
+        return pos, map_hash(data)
+    print(f"{path} not found: baking against the ring fallback, playable with any map")
+    radius = math.sqrt(NUM_LEDS)
+    pos = [(math.cos(2 * math.pi * i / NUM_LEDS) * radius, math.sin(2 * math.pi * i / NUM_LEDS) * radius)
+           for i in range(NUM_LEDS)]
+    return pos, 0
+
+
+def map_hash(data):
+    """FNV-1a over ledmap.bin, as BakedShow::mapHash()."""
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+# ===== Encoding =====
+
+def encode_delta(prev, cur):
+    """Payload for cur against prev: skip tokens (t < 0x80: t + 1 bytes) and literal runs."""
+    out = bytearray()
+    i = 0
+    while i < FRAME_BYTES:
+        same = 0
+        while i + same < FRAME_BYTES and prev[i + same] == cur[i + same]:
+            same += 1
+        if i + same == FRAME_BYTES:
+            break                          # Unchanged tail: nothing to write
+        while same > 0:
+            n = min(same, 128)
+            out.append(n - 1)
+            i += n
+            same -= n
+        # Literal run; unchanged gaps of up to 2 bytes stay inside (cheaper than skip + new run)
+        start = i
+        while i < FRAME_BYTES and i - start < 128:
+            if prev[i] == cur[i]:
+                gap = 0
+                while i + gap < FRAME_BYTES and gap < 3 and prev[i + gap] == cur[i + gap]:
+                    gap += 1
+                if gap > 2 or i + gap == FRAME_BYTES:
+                    break
+                i += min(gap, 128 - (i - start))
+                continue
+            i += 1
+        out.append(0x7F + (i - start))
+        out += cur[start:i]
+    return bytes(out)
+
+
+def decode_delta(payload, frame):
+    i = out = 0
+    while i < len(payload):
+        t = payload[i]
+        i += 1
+        if t < 0x80:
+            out += t + 1
+        else:
+            n = t - 0x7F
+            frame[out:out + n] = payload[i:i + n]
+            i += n
+            out += n
+        if out > FRAME_BYTES:
+            raise ValueError("payload runs past the frame")
+
+
+def write_show(path, frames, fps, mhash):
+    prev = bytes(FRAME_BYTES)
+    body = bytearray()
+    for frame in frames:
+        payload = encode_delta(prev, frame)
+        body += struct.pack("<H", len(payload)) + payload
+        prev = frame
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "wb") as f:
+        f.write(HEADER.pack(MAGIC, NUM_LEDS, fps, 0, len(frames), mhash))
+        f.write(body)
+    return len(body)
+
+
+def read_show(path):
+    """Header fields and the decoded frames (one loop)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, leds, fps, _, count, mhash = HEADER.unpack_from(data)
+    if magic != MAGIC or leds != NUM_LEDS:
+        sys.exit(f"{path}: not a baked show for {NUM_LEDS} LEDs")
+    frames, sizes = [], []
+    frame = bytearray(FRAME_BYTES)
+    pos = HEADER.size
+    for _ in range(count):
+        (size,) = struct.unpack_from("<H", data, pos)
+        decode_delta(data[pos + 2:pos + 2 + size], frame)
+        frames.append(bytes(frame))
+        sizes.append(size + 2)
+        pos += 2 + size
+    return fps, mhash, frames, sizes
+
+
+def print_info(path, fps, mhash, frames, sizes):
+    total = sum(sizes)
+    rate = total / len(frames) * fps
+    budget = CHUNK_SIZE * CHUNKS_WITH_AUDIO * fps
+    crc = 0
+    for frame in frames:
+        crc = zlib.crc32(frame, crc)
+    print(f"{path}: {len(frames)} frames at {fps} fps ({len(frames) / fps:.1f} s), map hash {mhash:08x}")
+    print(f"  {total} bytes, {total / len(frames):.0f} per frame (max {max(sizes)}), "
+          f"{total * 100 / (len(frames) * FRAME_BYTES):.0f}% of raw")
+    print(f"  stream {rate / 1000:.1f} kB/s; with audio playing the player reads up to {budget / 1000:.1f} kB/s"
+          + ("" if rate <= budget else "  ** over budget: expect underruns while audio plays **"))
+    print(f"  frames crc32 {crc:08x}")
+
+
+# ===== Effects =====
+
+def hue_rgb(h):
+    """Full-saturation hue (0..1) to RGB bytes."""
+    r, g, b = (max(0.0, min(1.0, abs((h * 6 + k) % 6 - 3) - 1)) for k in (0, 4, 2))
+    return r * 255, g * 255, b * 255
+
+
+def bake_sparks(pos, fps, seconds, seed):
+    rnd = random.Random(seed)
+    extent = max(math.hypot(x, y) for x, y in pos) or 1.0
+    glow = extent * 0.12                    # Spark radius
+    particles = []                          # [x, y, vx, vy, life, r, g, b]
+    frames = []
+    dt = 1.0 / fps
+    for step in range(int(seconds * fps)):
+        # A burst every ~1.5 s, single sparks in between
+        burst = 14 if step % int(1.5 * fps) == 0 else (1 if rnd.random() < 0.3 else 0)
+        hue = rnd.random()
+        for _ in range(burst):
+            a = rnd.uniform(0, 2 * math.pi)
+            v = extent * rnd.uniform(0.4, 1.1)
+            r, g, b = hue_rgb((hue + rnd.uniform(-0.06, 0.06)) % 1.0)
+            particles.append([0.0, 0.0, math.cos(a) * v, math.sin(a) * v, 1.0, r, g, b])
+        for p in particles:
+            p[0] += p[2] * dt
+            p[1] += p[3] * dt
+            p[2] *= 0.97
+            p[3] *= 0.97
+            p[4] -= dt / 1.6
+        particles = [p for p in particles if p[4] > 0 and math.hypot(p[0], p[1]) < extent * 1.3]
+
+        frame = bytearray(FRAME_BYTES)
+        for i, (x, y) in enumerate(pos):
+            acc = [0.0, 0.0, 0.0]
+            for p in particles:
+                d2 = ((x - p[0]) ** 2 + (y - p[1]) ** 2) / (glow * glow)
+                if d2 < 4.0:
+                    w = math.exp(-d2) * p[4] * p[4]
+                    acc[0] += p[5] * w
+                    acc[1] += p[6] * w
+                    acc[2] += p[7] * w
+            frame[i * 3:i * 3 + 3] = bytes(min(255, int(c)) for c in acc)
+        frames.append(bytes(frame))
+    return frames
+
+
+def read_png(path):
+    """8-bit RGB/RGBA, non-interlaced PNG as (width, height, rows of RGB bytes)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG")
+    pos, idat = 8, b""
+    while pos < len(data):
+        length, kind = struct.unpack_from(">I4s", data, pos)
+        chunk = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+        pos += 12 + length
+    if depth != 8 or ctype not in (2, 6) or interlace:
+        sys.exit(f"{path}: only 8-bit RGB/RGBA non-interlaced PNGs")
+    bpp = 3 if ctype == 2 else 4
+    raw = zlib.decompress(idat)
+    stride = w * bpp
+    rows, prev = [], bytearray(stride)
+    for y in range(h):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+        rows.append(bytes(line[i] for i in range(stride) if i % bpp < 3))
+    return w, h, rows
+
+
+def bake_sweep(pos, fps, seconds, image):
+    """The image slides right to left across the dome and wraps; its height spans the map."""
+    w, h, rows = read_png(image)
+    xs = [x for x, _ in pos]
+    ys = [y for _, y in pos]
+    x0, x1, y0, y1 = min(xs), max(xs), min(ys), max(ys)
+    span = max(x1 - x0, y1 - y0) or 1.0
+    frames = []
+    count = int(seconds * fps)
+    for step in range(count):
+        offset = step / count * w              # One pass of the image per loop
+        frame = bytearray(FRAME_BYTES)
+        for i, (x, y) in enumerate(pos):
+            u = int(offset + (x - x0) / span * h) % w   # Square pixels: map height = image height
+            v = min(h - 1, int((y1 - y) / span * h))
+            frame[i * 3:i * 3 + 3] = rows[v][u * 3:u * 3 + 3]
+        frames.append(bytes(frame))
+    return frames
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Bake a light show into a .lsb file")
+    ap.add_argument("effect", nargs="?", choices=["sparks", "sweep"], help="effect to bake")
+    ap.add_argument("-o", "--output", help="output .lsb (e.g. sdroot/light_shows/1.lsb)")
+    ap.add_argument("--ledmap", default=os.path.join("sdroot", "ledmap.bin"), help="LED map (default sdroot/ledmap.bin)")
+    ap.add_argument("--fps", type=int, default=25, help="frames per second (default 25)")
+    ap.add_argument("--seconds", type=float, default=20.0, help="length of one loop (default 20)")
+    ap.add_argument("--seed", type=int, default=1, help="random seed (sparks)")
+    ap.add_argument("--image", help="PNG for sweep")
+    ap.add_argument("--info", metavar="LSB", help="print size, stream rate and checksum of a baked show")
+    args = ap.parse_args()
+
+    if args.info:
+        print_info(args.info, *read_show(args.info))
+        return
+    if not args.effect or not args.output:
+        ap.error("effect and -o are required")
+    if not 1 <= args.fps <= 255:
+        ap.error("--fps must be 1..255")
+
+    pos, mhash = load_ledmap(args.ledmap)
+    if args.effect == "sparks":
+        frames = bake_sparks(pos, args.fps, args.seconds, args.seed)
+    else:
+        if not args.image:
+            ap.error("sweep needs --image")
+        frames = bake_sweep(pos, args.fps, args.seconds, args.image)
+    if not frames:
+        ap.error("nothing to bake")
+
+    write_show(args.output, frames, args.fps, mhash)
+    show = read_show(args.output)
+    if show[2] != frames:
+        sys.exit(f"{args.output}: decoded frames differ from the baked ones")
+    print_info(args.output, *show)
+
+
+if __name__ == "__main__":
+    main()
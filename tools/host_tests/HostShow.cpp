@@ -0,0 +1,119 @@
+/**
+ * @file HostShow.cpp
+ * @brief Light show on a virtual clock for the host tests implementation
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#include <Arduino.h>
+#include <FastLED.h>
+#include <SD.h>
+
+#include "HostShow.h"
+#include "HostTest.h"
+#include "LEDMap.h"
+#include "TimerManager.h"
+#include "PatternCatalog.h"
+#include "ColorsCatalog.h"
+#include "ZoneTable.h"
+
+namespace HostShow {
+
+namespace {
+
+uint32_t simMs = 0;
+CRGB stripOut[NUM_LEDS];
+bool shownThisTick = false;
+TimerHandle repaintTimer;
+uint16_t repaintMs = 50;
+uint16_t fixedMs = 0;
+TickHook tickHook;
+ShowHook showHook;
+
+uint32_t simClock() {
+    return simMs;
+}
+
+void onShow(const CRGB *out, int count) {
+    memcpy(stripOut, out, sizeof(CRGB) * min(count, NUM_LEDS));
+    shownThisTick = true;
+    if (showHook) showHook(simMs, stripOut);
+}
+
+// Same as LightBoot's repaint callback, plus the hook
+void cb_repaint() {
+    shownThisTick = false;
+    const HostTest::Stopwatch watch;
+    const uint64_t startCycles = HostTest::cycles();
+    updateLightController();
+    const uint64_t cycles = HostTest::cycles() - startCycles;
+    const Tick tick{simMs, shownThisTick, watch.us(), cycles, stripOut};
+    if (tickHook) tickHook(tick);
+
+    const uint16_t wantMs = fixedMs ? fixedMs : getFrameIntervalMs();
+    if (wantMs != repaintMs && timers.restart(repaintTimer, wantMs, 0)) {
+        repaintMs = wantMs;
+    }
+}
+
+} // namespace
+
+bool begin(const char *sdRoot) {
+    SD.setRoot(sdRoot);
+    timers.setClock(simClock);
+    FastLED.addLeds(leds, NUM_LEDS);
+    FastLED.setShowHook(onShow);
+    PatternCatalog::instance().begin();
+    ColorsCatalog::instance().begin();
+    const bool mapped = loadLEDMapFromSD("/ledmap.bin");
+    if (!mapped) fprintf(stderr, "no %s/ledmap.bin: LED ring fallback\n", sdRoot);
+    ZoneTable::instance().begin();
+    return mapped;
+}
+
+bool loadShow(const char *patternId, const char *colorId, LightShowParams &params) {
+    PatternCatalog &patterns = PatternCatalog::instance();
+    const String pattern = patternId ? String(patternId) : patterns.firstPatternId();
+    if (!patterns.getParamsForId(pattern, params)) {
+        fprintf(stderr, "pattern '%s' not found\n", pattern.c_str());
+        return false;
+    }
+    ColorsCatalog &colors = ColorsCatalog::instance();
+    const String color = colorId ? String(colorId) : colors.firstColorId();
+    String label;
+    if (!colors.getColorById(color, label, params.RGB1, params.RGB2)) {
+        fprintf(stderr, "color '%s' not found\n", color.c_str());
+        return false;
+    }
+    return true;
+}
+
+void play(const LightShowParams &params, uint8_t brightness, uint16_t frameMs) {
+    setBrightnessBaseHi(brightness);
+    setBrightnessShiftedHi(brightness);
+    fixedMs = frameMs;
+    if (!repaintTimer) {
+        repaintMs = fixedMs ? fixedMs : repaintMs;
+        repaintTimer = timers.create(repaintMs, 0, cb_repaint, 1.0f, 1, TimerPriority::REALTIME);
+    }
+    PlayLightShow(params);
+}
+
+void run(uint32_t ms, const TickHook &hook) {
+    tickHook = hook;
+    const uint32_t endMs = simMs + ms;
+    while (simMs < endMs) {
+        simMs += max<uint32_t>(1, timers.nextDeadline(endMs - simMs));
+        timers.update();
+    }
+    tickHook = nullptr;
+}
+
+void setShowHook(const ShowHook &hook) {
+    showHook = hook;
+}
+
+uint32_t now() {
+    return simMs;
+}
+
+} // namespace HostShow
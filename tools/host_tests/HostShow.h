@@ -0,0 +1,52 @@
+/**
+ * @file HostShow.h
+ * @brief Light show on a virtual clock for the host tests
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * The firmware's LightController driven like on the device: catalogs and the
+ * LED map from an SD root, the repaint timer as LightBoot sets it up (governor
+ * interval, REALTIME priority), TimerManager on a virtual clock that jumps to
+ * the next deadline. Every repaint tick reaches an optional hook with the
+ * strip output, so a test can check or record frames; other timers (an audio
+ * stand-in, say) may run next to it on the same clock.
+ */
+#pragma once
+
+#include <FastLED.h>
+#include <functional>
+
+#include "LightController.h"
+
+namespace HostShow {
+
+struct Tick {
+    uint32_t atMs;          // Virtual time of the repaint
+    bool shown;             // FastLED.show() ran in this tick
+    double renderUs;        // Host time of updateLightController()
+    uint64_t renderCycles;  // The same in HostTest::cycles()
+    const CRGB *out;        // Last buffer handed to FastLED.show()
+};
+
+using TickHook = std::function<void(const Tick &)>;
+// Every FastLED.show(), repaint or not, with the virtual time and the strip output
+using ShowHook = std::function<void(uint32_t atMs, const CRGB *out)>;
+
+// SD root, virtual clock, FastLED capture, catalogs, /ledmap.bin (ring fallback) and zones
+bool begin(const char *sdRoot);
+
+// Pattern and color set by id (nullptr = the first one) into params
+bool loadShow(const char *patternId, const char *colorId, LightShowParams &params);
+
+// PlayLightShow at brightness with the repaint timer running; frameMs > 0 fixes its interval
+void play(const LightShowParams &params, uint8_t brightness, uint16_t frameMs = 0);
+
+// Advance the virtual clock by ms, calling hook after every repaint tick
+void run(uint32_t ms, const TickHook &hook = nullptr);
+
+// Hook for every strip output until replaced (nullptr = none)
+void setShowHook(const ShowHook &hook);
+
+uint32_t now();
+
+} // namespace HostShow
@@ -0,0 +1,68 @@
+/**
+ * @file HostTest.h
+ * @brief Pass/fail reporting shared by the host tests
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * A test prints one line per check ("what: ok" or "what: FAIL") plus whatever
+ * numbers explain it, and returns HostTest::result() from main(): 0 when every
+ * check passed, 1 otherwise. run_all.sh runs every test and exits non-zero if
+ * any of them did, so CI gates on it directly.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace HostTest {
+
+inline int &failures() {
+    static int count = 0;
+    return count;
+}
+
+// Print the outcome of one check; returns pass so callers can chain on it
+inline bool check(const char *what, bool pass) {
+    printf("%s: %s\n", what, pass ? "ok" : "FAIL");
+    if (!pass) failures()++;
+    return pass;
+}
+
+inline int result() {
+    return failures() == 0 ? 0 : 1;
+}
+
+// SD root with the fixtures (run_all.sh builds it): first argument, else $HOST_TEST_SD, else sdroot
+inline const char *sdRoot(int argc, char **argv) {
+    if (argc > 1) return argv[1];
+    const char *env = getenv("HOST_TEST_SD");
+    return env && *env ? env : "sdroot";
+}
+
+// Wall time since construction
+class Stopwatch {
+public:
+    double us() const {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+};
+
+// Processor cycles: the x86 time-stamp counter; nanoseconds on other hosts
+inline uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+} // namespace HostTest
@@ -0,0 +1,131 @@
+/**
+ * @file TimerManagerBaseline.h
+ * @brief TimerManager before the deadline heap, for the host benchmark
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * The linear-scan pool of the baseline (version 260212I): every update()
+ * walks all MAX_TIMERS slots, create/cancel/restart/isActive scan for the
+ * (cb, token) pair. Only the clock (millis() there) is injectable and the
+ * loop counters are wide enough for large pools; the logic is unchanged.
+ * test_timer_pool runs it against lib/TimerManager on the same workload.
+ */
+#pragma once
+
+#include <Arduino.h>
+#include "TimerManager.h"
+
+class TimerManagerBaseline {
+public:
+    struct Timer {
+        bool active = false;
+        TimerCallback cb = nullptr;
+        uint8_t token = 1;
+        uint32_t interval = 0;
+        uint32_t nextTime = 0;
+        uint8_t repeat = 0;
+        float growthMultiplier = 1.0f;
+    };
+
+    explicit TimerManagerBaseline(TimerClock clock) : _clock(clock) {}
+
+    bool create(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth = 1.0f, uint8_t token = 1) {
+        if (!cb) return false;
+        for (uint16_t i = 0; i < MAX_TIMERS; i++) {
+            if (timers[i].active && timers[i].cb == cb && timers[i].token == token) return false;
+        }
+        for (uint16_t i = 0; i < MAX_TIMERS; i++) {
+            if (!timers[i].active) {
+                timers[i].active = true;
+                timers[i].cb = cb;
+                timers[i].token = token;
+                timers[i].interval = interval;
+                timers[i].nextTime = _clock() + interval;
+                timers[i].repeat = repeat;
+                timers[i].growthMultiplier = growth;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void cancel(TimerCallback cb, uint8_t token = 1) {
+        if (!cb) return;
+        for (uint16_t i = 0; i < MAX_TIMERS; i++) {
+            if (timers[i].active && timers[i].cb == cb && timers[i].token == token) {
+                timers[i].active = false;
+                timers[i].cb = nullptr;
+                timers[i].token = 1;
+                timers[i].growthMultiplier = 1.0f;
+                return;
+            }
+        }
+    }
+
+    bool restart(uint32_t interval, uint8_t repeat, TimerCallback cb, float growth = 1.0f, uint8_t token = 1) {
+        cancel(cb, token);
+        return create(interval, repeat, cb, growth, token);
+    }
+
+    bool isActive(TimerCallback cb, uint8_t token = 1) const {
+        if (!cb) return false;
+        for (uint16_t i = 0; i < MAX_TIMERS; i++) {
+            if (timers[i].active && timers[i].cb == cb && timers[i].token == token) return true;
+        }
+        return false;
+    }
+
+    void update() {
+        const uint32_t now = _clock();
+        for (uint16_t i = 0; i < MAX_TIMERS; i++) {
+            if (!timers[i].active) continue;
+            if (static_cast<int32_t>(now - timers[i].nextTime) >= 0) {
+                TimerCallback cb = timers[i].cb;
+                _remaining = timers[i].repeat;
+
+                const uint8_t originalRepeat = timers[i].repeat;
+                const uint32_t originalInterval = timers[i].interval;
+                const uint32_t originalNextTime = timers[i].nextTime;
+                const float originalGrowthMultiplier = timers[i].growthMultiplier;
+                const uint8_t originalToken = timers[i].token;
+
+                if (cb) cb();
+
+                if (!timers[i].active) continue;
+                if (timers[i].cb != cb) continue;
+                if (timers[i].token != originalToken) continue;
+                if (timers[i].interval != originalInterval || timers[i].nextTime != originalNextTime ||
+                    timers[i].repeat != originalRepeat || timers[i].growthMultiplier != originalGrowthMultiplier) {
+                    continue;
+                }
+
+                if (originalRepeat == 1) {
+                    timers[i].active = false;
+                    timers[i].cb = nullptr;
+                    timers[i].growthMultiplier = 1.0f;
+                    timers[i].token = 1;
+                } else {
+                    if (originalRepeat > 1) timers[i].repeat--;
+                    if (timers[i].growthMultiplier > 1.0f) {
+                        uint32_t newInterval = static_cast<uint32_t>(timers[i].interval * timers[i].growthMultiplier);
+                        timers[i].interval = min(newInterval, MAX_GROWTH_INTERVAL_MS);
+                    }
+                    timers[i].nextTime += timers[i].interval;
+                }
+            }
+        }
+    }
+
+    uint16_t getActiveCount() const {
+        uint16_t count = 0;
+        for (uint16_t i = 0; i < MAX_TIMERS; i++) {
+            if (timers[i].active) count++;
+        }
+        return count;
+    }
+
+private:
+    Timer timers[MAX_TIMERS];
+    uint8_t _remaining = 0;
+    TimerClock _clock;
+};
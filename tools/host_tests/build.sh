@@ -0,0 +1,117 @@
+#!/usr/bin/env bash
+# Build the host tests (host g++ / clang++, C++17): one binary per test_*.cpp in
+# tools/host_tests, each linked against the firmware sources below, unmodified,
+# and the stand-ins of tools/light_render/host. vendor/ holds third-party reference
+# code at the versions the firmware pins (FastLED's power model).
+# Needs ArduinoJson 6 sources like tools/light_render/build.sh: run `pio run` once,
+# or point ARDUINOJSON_DIR at its src/ directory.
+# Extra arguments go to the compiler, e.g. ./build.sh -DLIGHT_FIXED_POINT=1
+set -e
+cd "$(dirname "$0")/../.."
+
+CXX="${CXX:-g++}"
+ARDUINOJSON_DIR="${ARDUINOJSON_DIR:-.pio/libdeps/esp32/ArduinoJson/src}"
+OUT=tools/host_tests/build
+mkdir -p "$OUT/obj"
+
+FLAGS=(-std=gnu++17 -O2
+    -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -DARDUINOJSON_ENABLE_ARDUINO_STREAM=0
+    -DARDUINOJSON_ENABLE_ARDUINO_PRINT=0 -DARDUINOJSON_ENABLE_PROGMEM=0
+    -Itools/host_tests -Itools/light_render/host -Itools/host_tests/vendor/FastLED
+    -Ilib/Globals -Ilib/LightController -Ilib/TimerManager -Ilib/RunManager -Ilib/RunManager/Light
+    -Ilib/RunManager/Heartbeat -Ilib/ContextController
+    -Ilib/AudioManager -Ilib/SensorController -Ilib/SDController
+    -I"$ARDUINOJSON_DIR"
+    "$@")
+
+SOURCES=(
+    tools/host_tests/HostShow.cpp tools/host_tests/vendor/FastLED/power_mgt.cpp
+    tools/light_render/host/HostStubs.cpp tools/light_render/host/HostFirmware.cpp
+    tools/light_render/host/HeartbeatLedHost.cpp
+    lib/LightController/LightController.cpp lib/LightController/LightCompositor.cpp lib/LightController/LEDMap.cpp
+    lib/LightController/LightVM.cpp lib/LightController/LightPower.cpp lib/LightController/BakedShow.cpp
+    lib/LightController/LightZones.cpp lib/LightController/LightNoise.cpp
+    lib/AudioManager/AudioSpectrum.cpp
+    lib/TimerManager/TimerManager.cpp
+    lib/Globals/LogBuffer.cpp lib/Globals/CsvUtils.cpp lib/Globals/SdPathUtils.cpp
+    lib/RunManager/Light/PatternCatalog.cpp lib/RunManager/Light/ColorsCatalog.cpp
+    lib/RunManager/Light/ZoneTable.cpp lib/RunManager/Light/LightPolicy.cpp
+    lib/RunManager/Heartbeat/HeartbeatPolicy.cpp lib/RunManager/Heartbeat/HeartbeatRun.cpp
+)
+
+# Firmware and stand-ins once, in parallel; then every test against the same objects
+OBJECTS=()
+PIDS=()
+for src in "${SOURCES[@]}"; do
+    obj="$OUT/obj/$(basename "${src%.cpp}").o"
+    OBJECTS+=("$obj")
+    "$CXX" "${FLAGS[@]}" -c "$src" -o "$obj" &
+    PIDS+=($!)
+done
+for pid in "${PIDS[@]}"; do wait "$pid"; done
+
+for test in tools/host_tests/test_*.cpp; do
+    name="$(basename "${test%.cpp}")"
+    "$CXX" "${FLAGS[@]}" "$test" "${OBJECTS[@]}" -o "$OUT/$name" -lpthread
+    echo "built $OUT/$name"
+done
+
+# TimerManager against the baseline linear scan: one binary per pool size, each with its own
+# TimerManager build (MAX_TIMERS sizes the pool at compile time)
+for slots in 40 200 1000; do
+    "$CXX" "${FLAGS[@]}" -DMAX_TIMERS=$slots tools/host_tests/timer_pool.cpp lib/TimerManager/TimerManager.cpp \
+        tools/light_render/host/HostStubs.cpp -o "$OUT/test_timer_pool_$slots"
+    echo "built $OUT/test_timer_pool_$slots"
+done
+
+# Fixed-point renderer against the float one: light_golden writes the float frames (run_all.sh),
+# test_light_fixed compares; each links its own LightController build
+GOLDEN_OBJECTS=($(printf '%s\n' "${OBJECTS[@]}" | grep -v /LightController.o))
+for fixed in 0 1; do
+    "$CXX" "${FLAGS[@]}" -ULIGHT_FIXED_POINT -DLIGHT_FIXED_POINT=$fixed -c lib/LightController/LightController.cpp \
+        -o "$OUT/obj/LightController_fixed$fixed.o"
+done
+"$CXX" "${FLAGS[@]}" -ULIGHT_FIXED_POINT -DLIGHT_FIXED_POINT=0 tools/host_tests/light_golden.cpp \
+    "$OUT/obj/LightController_fixed0.o" "${GOLDEN_OBJECTS[@]}" -o "$OUT/light_golden" -lpthread
+"$CXX" "${FLAGS[@]}" -ULIGHT_FIXED_POINT -DLIGHT_FIXED_POINT=1 tools/host_tests/light_golden.cpp \
+    "$OUT/obj/LightController_fixed1.o" "${GOLDEN_OBJECTS[@]}" -o "$OUT/test_light_fixed" -lpthread
+echo "built $OUT/light_golden $OUT/test_light_fixed"
+
+# The ring render loop against the baseline: light_render.cpp includes LightController.cpp to call
+# its static updateGeometry() and renderLeds(), so it links without the shared LightController object
+"$CXX" "${FLAGS[@]}" -Ilib/LightController tools/host_tests/light_render.cpp "${GOLDEN_OBJECTS[@]}" \
+    -o "$OUT/test_light_render" -lpthread
+echo "built $OUT/test_light_render"
+
+# The Run layer over a simulated day: the real Alert/Audio/Context state in place of
+# HostFirmware.cpp, and the hardware below it from tools/host_tests/sim
+SIM_FLAGS=("${FLAGS[@]}" -Itools/host_tests/sim -Ilib/ClockController -Ilib/WiFiController
+    -Ilib/WebInterfaceController -Ilib/RunManager/Audio -Ilib/RunManager/Calendar -Ilib/RunManager/Speak
+    -Ilib/RunManager/Sensors -Ilib/RunManager/Alert)
+SIM_SOURCES=(
+    tools/host_tests/sim/SimStubs.cpp
+    lib/RunManager/Light/LightRun.cpp lib/RunManager/Light/ShiftTable.cpp
+    lib/RunManager/Audio/AudioRun.cpp lib/RunManager/Audio/AudioPolicy.cpp lib/RunManager/Audio/AudioDirector.cpp
+    lib/RunManager/Audio/AudioShiftTable.cpp
+    lib/RunManager/Calendar/CalendarRun.cpp lib/RunManager/Calendar/CalendarPolicy.cpp
+    lib/RunManager/Speak/SpeakRun.cpp
+    lib/RunManager/Sensors/SensorsRun.cpp lib/RunManager/Sensors/SensorsPolicy.cpp
+    lib/RunManager/Alert/AlertState.cpp
+    lib/AudioManager/AudioState.cpp
+    lib/ContextController/ContextController.cpp lib/ContextController/StatusFlags.cpp
+    lib/ContextController/TimeOfDay.cpp lib/ContextController/Calendar.cpp lib/ContextController/CalendarCsv.cpp
+    lib/ContextController/ThemeBoxTable.cpp lib/ContextController/TodayContext.cpp
+)
+mkdir -p "$OUT/obj/sim"
+SIM_OBJECTS=()
+PIDS=()
+for src in "${SIM_SOURCES[@]}"; do
+    obj="$OUT/obj/sim/$(basename "${src%.cpp}").o"
+    SIM_OBJECTS+=("$obj")
+    "$CXX" "${SIM_FLAGS[@]}" -c "$src" -o "$obj" &
+    PIDS+=($!)
+done
+for pid in "${PIDS[@]}"; do wait "$pid"; done
+"$CXX" "${SIM_FLAGS[@]}" tools/host_tests/run_day.cpp "${SIM_OBJECTS[@]}" \
+    $(printf '%s\n' "${OBJECTS[@]}" | grep -v -e /HostFirmware.o -e /HostShow.o) -o "$OUT/test_run_day"
+echo "built $OUT/test_run_day"
@@ -0,0 +1,154 @@
+/**
+ * @file light_golden.cpp
+ * @brief Host test: fixed-point renderer against golden frames of the float renderer
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * build.sh compiles this twice, each against its own LightController build:
+ * light_golden (LIGHT_FIXED_POINT 0) and test_light_fixed (LIGHT_FIXED_POINT 1).
+ * Both play every row of light_patterns.csv for GOLDEN_MS of virtual time at
+ * 50 fps and full brightness, without morph, power cap or dithering, so each
+ * tick's strip output is the rendered frame itself. light_golden writes those
+ * frames and its cycles per frame to <sd>/light_golden.bin (run_all.sh runs it
+ * while building the fixtures); test_light_fixed renders the same ticks and
+ * fails when any channel of any frame is more than 1 LSB off. Both paths report
+ * cycles per frame (x86 time-stamp counter; ns on other hosts).
+ */
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+#include "Globals.h"
+#include "PatternCatalog.h"
+#include "HostShow.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint32_t GOLDEN_MS = 5000;
+constexpr uint16_t FRAME_MS = 20;
+constexpr uint32_t TICKS = GOLDEN_MS / FRAME_MS;
+constexpr uint8_t MAX_DIFF = 1;
+
+struct PatternFrames {
+    std::string id;
+    double cyclesPerFrame = 0.0;
+    std::vector<CRGB> frames;  // TICKS x NUM_LEDS
+};
+
+// Every pattern with the first color set; morph, power cap and dithering off
+std::vector<PatternFrames> renderAll() {
+    Globals::lightMorphMs = 0;
+    Globals::maxMilliamps = 60000U;
+    Globals::lightDitherMinFps = 255;  // Above 50 fps: rounded output
+
+    std::vector<PatternFrames> all;
+    PatternCatalog &patterns = PatternCatalog::instance();
+    const String first = patterns.firstPatternId();
+    String error;
+    if (first.isEmpty() || !patterns.select(first, error)) return all;
+    do {
+        LightShowParams params;
+        if (!HostShow::loadShow(patterns.activeId().c_str(), nullptr, params)) continue;
+        PatternFrames p;
+        p.id = patterns.activeId().c_str();
+        p.frames.reserve(TICKS * NUM_LEDS);
+        uint64_t cycles = 0;
+        HostShow::play(params, 255, FRAME_MS);
+        HostShow::run(GOLDEN_MS, [&](const HostShow::Tick &tick) {
+            if (p.frames.size() < TICKS * NUM_LEDS) p.frames.insert(p.frames.end(), tick.out, tick.out + NUM_LEDS);
+            cycles += tick.renderCycles;
+        });
+        p.cyclesPerFrame = static_cast<double>(cycles) / TICKS;
+        all.push_back(std::move(p));
+    } while (patterns.selectNext(error) && patterns.activeId() != first);
+    return all;
+}
+
+// light_golden.bin: per pattern the id (NUL-terminated), cycles per frame (double) and TICKS frames.
+// Each build uses one side, like main() below.
+#if !LIGHT_FIXED_POINT
+bool writeGolden(const std::string &path, const std::vector<PatternFrames> &all) {
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (!fp) return false;
+    for (const PatternFrames &p : all) {
+        fwrite(p.id.c_str(), 1, p.id.size() + 1, fp);
+        fwrite(&p.cyclesPerFrame, sizeof(p.cyclesPerFrame), 1, fp);
+        fwrite(p.frames.data(), sizeof(CRGB), p.frames.size(), fp);
+    }
+    return fclose(fp) == 0;
+}
+#else
+std::vector<PatternFrames> readGolden(const std::string &path) {
+    std::vector<PatternFrames> all;
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) return all;
+    for (int c; (c = fgetc(fp)) != EOF;) {
+        PatternFrames p;
+        for (; c != EOF && c != 0; c = fgetc(fp)) p.id += static_cast<char>(c);
+        p.frames.resize(TICKS * NUM_LEDS);
+        if (fread(&p.cyclesPerFrame, sizeof(p.cyclesPerFrame), 1, fp) != 1 ||
+            fread(p.frames.data(), sizeof(CRGB), p.frames.size(), fp) != p.frames.size()) {
+            break;
+        }
+        all.push_back(std::move(p));
+    }
+    fclose(fp);
+    return all;
+}
+#endif
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::string root = HostTest::sdRoot(argc, argv);
+    HostShow::begin(root.c_str());
+    const std::string path = root + "/light_golden.bin";
+    const std::vector<PatternFrames> rendered = renderAll();
+
+#if !LIGHT_FIXED_POINT
+    double cycles = 0.0;
+    for (const PatternFrames &p : rendered) cycles += p.cyclesPerFrame;
+    printf("%zu patterns, %u frames each: float renderer %.0f cycles per frame\n", rendered.size(), TICKS,
+           rendered.empty() ? 0.0 : cycles / rendered.size());
+    return HostTest::check(("golden frames written to " + path).c_str(),
+                           !rendered.empty() && writeGolden(path, rendered))
+               ? 0
+               : 1;
+#else
+    const std::vector<PatternFrames> golden = readGolden(path);
+    if (!HostTest::check(("golden frames in " + path + " (run_all.sh)").c_str(),
+                         !golden.empty() && golden.size() == rendered.size())) {
+        return HostTest::result();
+    }
+
+    printf("pattern  float cycles  fixed cycles  largest diff  channels off by 1\n");
+    double floatCycles = 0.0, fixedCycles = 0.0;
+    uint8_t worst = 0;
+    bool sameIds = true;
+    for (size_t n = 0; n < golden.size(); n++) {
+        const PatternFrames &g = golden[n];
+        const PatternFrames &r = rendered[n];
+        sameIds = sameIds && g.id == r.id && r.frames.size() == g.frames.size();
+        uint8_t largest = 0;
+        uint32_t offByOne = 0;
+        for (size_t i = 0; i < min(g.frames.size(), r.frames.size()); i++) {
+            for (uint8_t c = 0; c < 3; c++) {
+                const uint8_t diff = static_cast<uint8_t>(abs(g.frames[i].raw[c] - r.frames[i].raw[c]));
+                largest = max(largest, diff);
+                offByOne += diff == 1;
+            }
+        }
+        printf("%-7s  %12.0f  %12.0f  %12u  %16.3f%%\n", g.id.c_str(), g.cyclesPerFrame, r.cyclesPerFrame,
+               largest, 100.0 * offByOne / (3.0 * g.frames.size()));
+        floatCycles += g.cyclesPerFrame;
+        fixedCycles += r.cyclesPerFrame;
+        worst = max(worst, largest);
+    }
+    printf("%zu patterns, %u frames each: float %.0f, fixed %.0f cycles per frame\n", golden.size(), TICKS,
+           floatCycles / golden.size(), fixedCycles / golden.size());
+    HostTest::check("same patterns as the golden frames", sameIds);
+    HostTest::check("every frame within 1 LSB of the float renderer", worst <= MAX_DIFF);
+    return HostTest::result();
+#endif
+}
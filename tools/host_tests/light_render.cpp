@@ -0,0 +1,150 @@
+/**
+ * @file light_render.cpp
+ * @brief Host benchmark: ring render loop (updateGeometry + renderLeds) against the loop before the geometry cache
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * build.sh compiles this into test_light_render with LightController.cpp
+ * included below, so the benchmark calls the firmware's own static
+ * updateGeometry() and renderLeds(), nothing else of the repaint tick.
+ * Every ring pattern of the catalog (no program, baked show or noise) runs a
+ * minute of 50 fps frames, once as in the catalog and once with its center
+ * held still (xAmp = yAmp = 0). Each frame takes its ring pose from ringPose()
+ * and goes through both loops: the firmware's, and the per-LED loop of the
+ * baseline (version 261016B): getLEDPos() and sqrtf() for every LED, divide
+ * by fadeWidth. Reported per pattern: cycles per frame of both
+ * (HostTest::cycles()) and the largest channel difference. Checked: every LED
+ * of every frame within 1 LSB of the baseline, the firmware loop at most
+ * MAX_RATIO of the baseline's cycles, moving or still, and a still center
+ * cheaper than a moving one.
+ */
+#include "LightController.cpp"
+
+#include <cmath>
+
+#include "PatternCatalog.h"
+#include "HostShow.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint32_t RUN_MS = 60000;
+constexpr uint16_t FRAME_MS = 20;
+constexpr uint8_t BRIGHTNESS = 200;
+constexpr double MAX_RATIO = 0.8;  // Firmware vs baseline cycles (about 0.6 still, 0.65 moving on x86)
+
+CRGB baselineOut[NUM_LEDS];
+uint16_t allLeds[NUM_LEDS];  // Pixel list of a show without zones
+
+// Phase 0..255 of a cycle after atMs, as the firmware's phase timers count it
+uint8_t phaseAt(uint32_t atMs, uint8_t cycleSec) {
+    const uint32_t stepMs = (static_cast<uint32_t>(cycleSec ? cycleSec : 10) * 1000UL) / 255UL;
+    return static_cast<uint8_t>(atMs / max<uint32_t>(stepMs, 1));
+}
+
+// The per-LED loop of the baseline's updateLightController()
+void renderBaseline(const LightShowParams &p, float animRadius, float centerX, float centerY, uint8_t windowStart,
+                    int windowWidth) {
+    for (int i = 0; i < NUM_LEDS; ++i) {
+        LEDPos pos = getLEDPos(i);
+        float dx = pos.x - centerX;
+        float dy = pos.y - centerY;
+        float dist = sqrtf(dx * dx + dy * dy);
+
+        float blend = MathUtils::clamp(fabsf(dist - animRadius) / p.fadeWidth, 0.0f, 1.0f);
+        float fade = 1.0f - blend;
+        fade = fade * fade;
+
+        int gradIdx = (windowStart + int(blend * (windowWidth - 1))) % GRADIENT_SIZE;
+        if (gradIdx < 0) gradIdx += GRADIENT_SIZE;
+        CRGB color = colorGradient[gradIdx];
+
+        uint8_t brightness = p.minBrightness + uint8_t(fade * (BRIGHTNESS - p.minBrightness));
+        if (brightness > 0) color.nscale8_video(brightness);
+        else                color = CRGB::Black;
+        baselineOut[i] = color;
+    }
+}
+
+struct Cost {
+    double firmwareCycles;  // Per frame: updateGeometry() + renderLeds()
+    double baselineCycles;  // Per frame of the baseline loop
+    uint8_t maxDiff;        // Largest channel difference over all frames
+};
+
+Cost measure(const LightShowParams &p) {
+    generateColorGradient(p.RGB1, p.RGB2, colorGradient);
+    geomValid = false;
+    const int windowWidth = p.windowWidth > 0 ? p.windowWidth : 16;
+
+    uint64_t firmwareCycles = 0, baselineCycles = 0;
+    uint8_t maxDiff = 0;
+    for (uint32_t atMs = 0; atMs < RUN_MS; atMs += FRAME_MS) {
+        float animRadius, centerX, centerY;
+        ringPose(p, showRadiusTable, phaseAt(atMs, p.brightCycleSec), phaseAt(atMs, p.xCycleSec),
+                 phaseAt(atMs, p.yCycleSec), animRadius, centerX, centerY);
+        const uint8_t windowStart = phaseAt(atMs, p.colorCycleSec);
+
+        uint64_t start = HostTest::cycles();
+        updateGeometry(centerX, centerY);
+        frameSums = LightPower::Sums();
+        renderLeds(allLeds, NUM_LEDS, p, animRadius, windowStart, windowWidth, BRIGHTNESS);
+        firmwareCycles += HostTest::cycles() - start;
+
+        start = HostTest::cycles();
+        renderBaseline(p, animRadius, centerX, centerY, windowStart, windowWidth);
+        baselineCycles += HostTest::cycles() - start;
+
+        for (int i = 0; i < NUM_LEDS; i++) {
+            for (uint8_t c = 0; c < 3; c++) {
+                maxDiff = max<uint8_t>(maxDiff, abs(frame[i].raw[c] - baselineOut[i].raw[c]));
+            }
+        }
+    }
+    const double frames = RUN_MS / FRAME_MS;
+    return Cost{firmwareCycles / frames, baselineCycles / frames, maxDiff};
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    HostShow::begin(HostTest::sdRoot(argc, argv));
+    for (uint16_t i = 0; i < NUM_LEDS; i++) allLeds[i] = i;
+
+    PatternCatalog &patterns = PatternCatalog::instance();
+    const String first = patterns.firstPatternId();
+    String error;
+    double moving[2] = {0.0, 0.0}, still[2] = {0.0, 0.0};  // Firmware, baseline
+    uint8_t maxDiff = 0;
+    int checked = 0;
+    if (!first.isEmpty() && patterns.select(first, error)) {
+        printf("pattern  moving: firmware  baseline   still: firmware  baseline  max diff  (cycles per frame)\n");
+        do {
+            LightShowParams params;
+            if (!HostShow::loadShow(patterns.activeId().c_str(), nullptr, params)) continue;
+            if (params.program || params.baked || params.noiseSize > 0.0f) continue;
+            const Cost m = measure(params);
+            params.xAmp = params.yAmp = 0.0f;
+            const Cost s = measure(params);
+            const uint8_t diff = max(m.maxDiff, s.maxDiff);
+            printf("%-7s  %16.0f  %8.0f  %15.0f  %8.0f  %8u\n", patterns.activeId().c_str(), m.firmwareCycles,
+                   m.baselineCycles, s.firmwareCycles, s.baselineCycles, diff);
+            moving[0] += m.firmwareCycles;
+            moving[1] += m.baselineCycles;
+            still[0] += s.firmwareCycles;
+            still[1] += s.baselineCycles;
+            maxDiff = max(maxDiff, diff);
+            checked++;
+        } while (patterns.selectNext(error) && patterns.activeId() != first);
+    }
+    const int runs = max(checked, 1);
+    printf("%d ring patterns, %d LEDs: moving %.0f vs %.0f cycles per frame (%.2fx), still %.0f vs %.0f (%.2fx)\n",
+           checked, NUM_LEDS, moving[0] / runs, moving[1] / runs, moving[0] / max(moving[1], 1.0), still[0] / runs,
+           still[1] / runs, still[0] / max(still[1], 1.0));
+    HostTest::check("ring patterns in light_patterns.csv", checked > 0);
+    HostTest::check("every LED within 1 LSB of the baseline loop", maxDiff <= 1);
+    HostTest::check("moving center: firmware loop well under the baseline", moving[0] <= moving[1] * MAX_RATIO);
+    HostTest::check("still center: firmware loop well under the baseline", still[0] <= still[1] * MAX_RATIO);
+    HostTest::check("still center cheaper than a moving one", still[0] < moving[0]);
+    return HostTest::result();
+}
@@ -0,0 +1,49 @@
+#!/usr/bin/env bash
+# Build and run every host test; exits 1 if any test failed (CI entry point).
+# The tests read a fixture SD root, tools/host_tests/build/sd: the CSV files of
+# sdroot plus what a real card carries next to them, generated here from the
+# sources in the repo (ledmap.bin from the PCB, compiled light programs, baked
+# shows, golden frames of the float renderer). Needs python3 for that.
+# Arguments go to build.sh.
+set -e
+cd "$(dirname "$0")/../.."
+
+tools/host_tests/build.sh "$@"
+
+SD=tools/host_tests/build/sd
+rm -rf "$SD"
+mkdir -p "$SD/light_programs" "$SD/light_shows"
+cp sdroot/*.csv "$SD/"
+cp sdroot/light_programs/*.lps "$SD/light_programs/"
+python3 -c "import sys; sys.path.insert(0, 'tools'); import generate_ledmap as g; \
+g.generate(g.extract_leds(g.PCB_PATH), sys.argv[1])" "$SD/ledmap.bin" >/dev/null
+for src in "$SD"/light_programs/*.lps; do
+    python3 tools/light_compile.py "$src" >/dev/null
+done
+python3 tools/bake_show.py sparks -o "$SD/light_shows/1.lsb" --ledmap "$SD/ledmap.bin" --seconds 10 >/dev/null
+# Full-color bands swept over the dome: frames well over the LED power budget
+python3 -c "import struct, sys, zlib
+bands = [(255, 255, 255), (255, 0, 0), (0, 255, 0), (0, 0, 255), (255, 160, 40), (0, 0, 0)]
+row = bytes(c for x in range(96) for c in bands[x // 16])
+png = lambda kind, data: struct.pack('>I', len(data)) + kind + data + struct.pack('>I', zlib.crc32(kind + data))
+open(sys.argv[1], 'wb').write(b'\\x89PNG\\r\\n\\x1a\\n' + png(b'IHDR', struct.pack('>IIBBBBB', 96, 8, 8, 2, 0, 0, 0))
+    + png(b'IDAT', zlib.compress(b''.join(b'\\0' + row for _ in range(8)))) + png(b'IEND', b''))" "$SD/bands.png"
+python3 tools/bake_show.py sweep --image "$SD/bands.png" -o "$SD/light_shows/2.lsb" --ledmap "$SD/ledmap.bin" \
+    --seconds 10 >/dev/null
+# Golden frames of the float renderer for test_light_fixed
+tools/host_tests/build/light_golden "$SD" >/dev/null
+
+FAILED=()
+for test in tools/host_tests/build/test_*; do
+    name="$(basename "$test")"
+    echo "== $name"
+    if ! "$test" "$SD"; then
+        FAILED+=("$name")
+    fi
+done
+
+if [ ${#FAILED[@]} -ne 0 ]; then
+    echo "FAILED: ${FAILED[*]}"
+    exit 1
+fi
+echo "all host tests passed"
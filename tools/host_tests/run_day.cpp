@@ -0,0 +1,180 @@
+/**
+ * @file run_day.cpp
+ * @brief Host simulation: 24 hours of the Run layer on TimerManager's virtual clock
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * build.sh links this into test_run_day with LightRun, AudioRun, CalendarRun,
+ * SpeakRun and SensorsRun, their policies and state modules unmodified, and
+ * the hardware stand-ins of sim/. The fixture SD root provides the CSV files
+ * (shifts, catalogs, calendar, theme boxes).
+ *
+ * Boot plans every Run module, then the loop calls timers.update() and jumps
+ * the clock straight to nextDeadline(). Visitors walk up to the dome between
+ * 08:00 and 23:00. Reported per hour: loop wakeups, timers in use, distance
+ * pings, sentences, lux reads. Checked:
+ *  - the day runs at least 10000x faster than real time (about 9.5 million
+ *    wakeups, mostly the 20 ms context tick and LightController's phase timers);
+ *  - the timer pool keeps headroom (peak below MAX_TIMERS);
+ *  - the lux measurement holds its interval (slack included) all day;
+ *  - the calendar is re-read every calendarRefreshIntervalMs;
+ *  - every visit gets a distance ping, and no ping sounds without a visitor.
+ */
+#include <Arduino.h>
+#include <SD.h>
+#include <random>
+#include <vector>
+
+#include "Globals.h"
+#include "TimerManager.h"
+#include "Calendar.h"
+#include "ContextController.h"
+#include "Light/LightRun.h"
+#include "Audio/AudioRun.h"
+#include "Calendar/CalendarRun.h"
+#include "Speak/SpeakRun.h"
+#include "Sensors/SensorsRun.h"
+#include "SimStubs.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint32_t HOUR_MS = 3600000UL;
+constexpr uint32_t DAY_MS = 24 * HOUR_MS;
+
+uint32_t clockMs = 0;
+
+uint32_t virtualClock() {
+    return clockMs;
+}
+
+struct Hour {
+    uint32_t wakeups = 0;
+    uint8_t peakTimers = 0;
+    uint32_t pings = 0;
+    uint32_t sentences = 0;
+    uint32_t luxReads = 0;
+    bool visited = false;
+};
+
+// Visitors from 08:00 to 23:00, on average every 20 minutes, staying 20 s to 2 min
+std::vector<Sim::Visit> planVisits() {
+    std::mt19937 rng(4711);
+    std::exponential_distribution<double> gap(1.0 / (20.0 * 60000.0));
+    std::uniform_int_distribution<uint32_t> stay(20000, 120000);
+    std::vector<Sim::Visit> visits;
+    for (uint32_t at = 8 * HOUR_MS + static_cast<uint32_t>(gap(rng)); at < 23 * HOUR_MS;) {
+        const Sim::Visit visit{at, stay(rng)};
+        visits.push_back(visit);
+        Sim::addVisit(visit);
+        at += visit.durationMs + static_cast<uint32_t>(gap(rng));
+    }
+    return visits;
+}
+
+// Static 10 ms click: the clip only has to exist for AudioRun to arm its pings
+const int16_t clickSamples[220] = {};
+const AudioManager::PCMClipDesc click{clickSamples, 220, 22050, 10};
+
+} // namespace
+
+int main(int argc, char **argv) {
+    SD.setRoot(HostTest::sdRoot(argc, argv));
+    timers.setClock(virtualClock);
+    Globals::distanceSensorPresent = true;
+
+    const std::vector<Sim::Visit> visits = planVisits();
+    std::vector<uint32_t> pingsPerVisit(visits.size(), 0);
+    uint32_t pingsAlone = 0;
+
+    const HostTest::Stopwatch watch;
+
+    // Boot, in RunManager's order for the modules simulated here
+    calendarSelector.begin(SD);
+    setDistanceClipPointer(&click);
+    ContextController::begin();
+    LightRun lightRun;
+    AudioRun audioRun;
+    SpeakRun speakRun;
+    SensorsRun sensorsRun;
+    lightRun.plan();
+    audioRun.plan();
+    calendarRun.plan();
+    speakRun.plan();
+    sensorsRun.plan();
+
+    Hour hours[24];
+    Sim::Counters seen;
+    uint32_t calendarLoads = 0;
+    uint32_t firstLoadMs = 0;
+    while (clockMs < DAY_MS) {
+        timers.update();
+        Hour &hour = hours[clockMs / HOUR_MS];
+        hour.wakeups++;
+        hour.peakTimers = max(hour.peakTimers, static_cast<uint8_t>(timers.getActiveCount()));
+        hour.sentences += Sim::counters.ttsSentences + Sim::counters.mp3Sentences - seen.ttsSentences -
+                          seen.mp3Sentences;
+        hour.luxReads += Sim::counters.luxReads - seen.luxReads;
+
+        // New pings belong to the visit in progress, if any; the sensor notices
+        // a departure only at its next poll, so that interval still counts
+        const uint32_t pings = Sim::counters.pcmPings - seen.pcmPings;
+        if (pings > 0) {
+            hour.pings += pings;
+            const uint32_t pollMs = Globals::sensorBaseDefaultMs;
+            size_t v = 0;
+            while (v < visits.size() && (clockMs < visits[v].startMs ||
+                                         clockMs > visits[v].startMs + visits[v].durationMs + pollMs)) {
+                v++;
+            }
+            if (v < visits.size()) pingsPerVisit[v] += pings;
+            else pingsAlone += pings;
+        }
+        // triggerBootFragment() ends every calendar load
+        if (Sim::counters.bootFragments != seen.bootFragments) {
+            if (calendarLoads == 0) firstLoadMs = clockMs;
+            calendarLoads += Sim::counters.bootFragments - seen.bootFragments;
+        }
+        seen = Sim::counters;
+
+        clockMs += max(1u, timers.nextDeadline());
+    }
+    const double wallUs = watch.us();
+
+    for (const Sim::Visit &v : visits) hours[v.startMs / HOUR_MS].visited = true;
+    printf("hour  wakeups  timers  pings  sentences  lux reads  visitors\n");
+    uint32_t wakeups = 0;
+    for (uint8_t h = 0; h < 24; h++) {
+        const Hour &hour = hours[h];
+        printf("%02u    %7u  %6u  %5u  %9u  %9u  %s\n", h, hour.wakeups, hour.peakTimers, hour.pings,
+               hour.sentences, hour.luxReads, hour.visited ? "yes" : "");
+        wakeups += hour.wakeups;
+    }
+    uint32_t visitsPinged = 0;
+    for (uint32_t p : pingsPerVisit) visitsPinged += p > 0;
+    printf("24 h in %.0f ms: %u loop wakeups, peak %u of %u timers\n", wallUs / 1000.0, wakeups,
+           timers.getMaxActiveTimers(), MAX_TIMERS);
+    printf("%zu visits, %u distance readings, %u pings (%u without a visitor), %u fragment stops\n",
+           visits.size(), Sim::counters.distanceEvents, Sim::counters.pcmPings, pingsAlone,
+           Sim::counters.fragmentStops);
+    printf("%u TTS and %u MP3 sentences, %u lux reads, %u GUI pushes, %u calendar loads\n",
+           Sim::counters.ttsSentences, Sim::counters.mp3Sentences, Sim::counters.luxReads,
+           Sim::counters.guiPushes, calendarLoads);
+
+    HostTest::check("at least 10000x faster than real time", wallUs < DAY_MS * 1000.0 / 10000.0);
+    HostTest::check("timer pool keeps headroom", timers.getMaxActiveTimers() < MAX_TIMERS);
+
+    // Each measurement reads once, a blanked one twice; slack may stretch the interval by a quarter
+    const uint32_t interval = Globals::luxMeasurementIntervalMs;
+    const uint32_t fewest = DAY_MS / (interval + interval / 4);
+    const uint32_t most = (DAY_MS / interval + 1) * 2;
+    HostTest::check("lux measured every luxMeasurementIntervalMs all day",
+                    Sim::counters.luxReads >= fewest && Sim::counters.luxReads <= most);
+
+    const uint32_t reloads = (DAY_MS - firstLoadMs) / Globals::calendarRefreshIntervalMs;
+    HostTest::check("calendar re-read every calendarRefreshIntervalMs",
+                    calendarLoads >= reloads && calendarLoads <= reloads + 1);
+    HostTest::check("every visit gets a distance ping", visitsPinged == visits.size() && !visits.empty());
+    HostTest::check("no ping without a visitor", pingsAlone == 0);
+    return HostTest::result();
+}
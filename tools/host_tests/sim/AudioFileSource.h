@@ -0,0 +1,16 @@
+/**
+ * @file AudioFileSource.h
+ * @brief Host stand-in for ESP8266Audio's file source (run simulation)
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#pragma once
+
+#include <Arduino.h>
+
+class AudioFileSource {
+public:
+    virtual ~AudioFileSource() = default;
+    virtual bool close() { return true; }
+    virtual bool isOpen() { return false; }
+};
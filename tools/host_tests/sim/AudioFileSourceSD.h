@@ -0,0 +1,11 @@
+/**
+ * @file AudioFileSourceSD.h
+ * @brief Host stand-in for ESP8266Audio's SD file source (run simulation)
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#pragma once
+
+#include "AudioFileSource.h"
+
+class AudioFileSourceSD : public AudioFileSource {};
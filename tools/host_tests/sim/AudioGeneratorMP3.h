@@ -0,0 +1,17 @@
+/**
+ * @file AudioGeneratorMP3.h
+ * @brief Host stand-in for ESP8266Audio's MP3 generator (run simulation)
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#pragma once
+
+#include "AudioFileSource.h"
+
+class AudioGeneratorMP3 {
+public:
+    virtual ~AudioGeneratorMP3() = default;
+    virtual bool isRunning() { return false; }
+    virtual bool loop() { return false; }
+    virtual bool stop() { return true; }
+};
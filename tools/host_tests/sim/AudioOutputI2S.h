@@ -0,0 +1,19 @@
+/**
+ * @file AudioOutputI2S.h
+ * @brief Host stand-in for ESP8266Audio's I2S output (run simulation)
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#pragma once
+
+#include <Arduino.h>
+
+class AudioOutputI2S {
+public:
+    virtual ~AudioOutputI2S() = default;
+    virtual bool begin() { return true; }
+    virtual bool SetRate(int) { return true; }
+    virtual bool ConsumeSample(int16_t[2]) { return true; }
+    virtual bool SetGain(float) { return true; }
+    virtual bool stop() { return true; }
+};
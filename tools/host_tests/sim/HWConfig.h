@@ -0,0 +1,12 @@
+/**
+ * @file HWConfig.h
+ * @brief Case alias of lib/Globals/HWconfig.h (run simulation)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * AlertState.cpp includes "HWConfig.h"; that resolves on the case-insensitive
+ * Windows build only.
+ */
+#pragma once
+
+#include "HWconfig.h"
@@ -0,0 +1,9 @@
+/**
+ * @file RTClib.h
+ * @brief Host stand-in for Adafruit RTClib (run simulation)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * RTCController.h only needs the include to resolve; the simulation has no RTC.
+ */
+#pragma once
@@ -0,0 +1,207 @@
+/**
+ * @file SimStubs.cpp
+ * @brief Hardware-facing modules under the Run layer, for the run simulation
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Defines what LightRun, AudioRun, CalendarRun, SpeakRun and SensorsRun call
+ * below the policy layer: the clock, audio output, sensors, the audio index
+ * and the web/NAS side. See SimStubs.h.
+ */
+#include <Arduino.h>
+#include <math.h>
+#include <vector>
+
+#include "SimStubs.h"
+#include "Globals.h"
+#include "AudioManager.h"
+#include "PlayFragment.h"
+#include "PlayPCM.h"
+#include "PlaySentence.h"
+#include "PRTClock.h"
+#include "RTCController.h"
+#include "SensorController.h"
+#include "SDController.h"
+#include "TimerManager.h"
+#include "WebGuiStatus.h"
+#include "NasBackup.h"
+#include "RunManager.h"
+#include "Alert/AlertRGB.h"
+#include "Alert/AlertRun.h"
+
+namespace Sim {
+
+Counters counters;
+
+namespace {
+
+std::vector<Visit> visits;
+uint32_t lastEventMs = UINT32_MAX;
+
+constexpr float SUNRISE_H = 7.75f;   // 8 October, the Netherlands
+constexpr float SUNSET_H = 18.8f;
+constexpr float NOON_LUX = 400.0f;   // Indoors, next to a window
+constexpr float FAR_MM = 3000.0f;
+constexpr float NEAR_MM = 300.0f;
+
+uint32_t secondsOfDay() {
+    return (timers.now() / 1000UL) % 86400UL;
+}
+
+// Distance of the visit at nowMs; with nobody there the sensor sees the far wall
+float visitorDistance(uint32_t nowMs) {
+    for (const Visit &v : visits) {
+        if (nowMs < v.startMs || nowMs - v.startMs >= v.durationMs) continue;
+        const float phase = static_cast<float>(nowMs - v.startMs) / static_cast<float>(v.durationMs);
+        const float approach = 1.0f - fabsf(2.0f * phase - 1.0f);  // 0 → 1 → 0
+        return FAR_MM - (FAR_MM - NEAR_MM) * approach;
+    }
+    return Globals::distanceMaxMm + 1000.0f;
+}
+
+} // namespace
+
+void addVisit(const Visit &visit) {
+    visits.push_back(visit);
+}
+
+float daylightLux(uint32_t nowMs) {
+    const float hour = static_cast<float>((nowMs / 1000UL) % 86400UL) / 3600.0f;
+    if (hour <= SUNRISE_H || hour >= SUNSET_H) return 0.5f;
+    const float phase = (hour - SUNRISE_H) / (SUNSET_H - SUNRISE_H);
+    return 0.5f + NOON_LUX * sinf(static_cast<float>(M_PI) * phase);
+}
+
+} // namespace Sim
+
+// ===== Clock: the simulated day, from the timer clock =====
+PRTClock prtClock;
+
+uint8_t PRTClock::getHour() const { return static_cast<uint8_t>(Sim::secondsOfDay() / 3600UL); }
+uint8_t PRTClock::getMinute() const { return static_cast<uint8_t>(Sim::secondsOfDay() / 60UL % 60UL); }
+uint8_t PRTClock::getSecond() const { return static_cast<uint8_t>(Sim::secondsOfDay() % 60UL); }
+uint8_t PRTClock::getYear() const { return static_cast<uint8_t>(Sim::START_YEAR - 2000); }
+uint8_t PRTClock::getMonth() const { return Sim::START_MONTH; }
+uint8_t PRTClock::getDay() const { return Sim::START_DAY; }
+bool PRTClock::hasValidDate() const { return true; }
+uint8_t PRTClock::getDoW() const { return Sim::START_DOW; }
+uint16_t PRTClock::getDoY() const { return 281; }
+uint8_t PRTClock::getSunriseHour() const { return 7; }
+uint8_t PRTClock::getSunriseMinute() const { return 45; }
+uint8_t PRTClock::getSunsetHour() const { return 18; }
+uint8_t PRTClock::getSunsetMinute() const { return 48; }
+float PRTClock::getMoonPhaseValue() const { return 0.5f; }
+bool PRTClock::isTimeFetched() const { return true; }
+
+namespace RTCController {
+bool isAvailable() { return false; }
+float getTemperature() { return NAN; }
+} // namespace RTCController
+
+// ===== Sensors: visitors and daylight =====
+namespace {
+float ambientLuxValue = 0.0f;
+float distanceMmValue = 0.0f;
+} // namespace
+
+bool SensorController::readEvent(SensorEvent &ev) {
+    const uint32_t now = timers.now();
+    if (now == Sim::lastEventMs) return false;  // One reading per poll
+    const float mm = Sim::visitorDistance(now);
+    Sim::lastEventMs = now;
+    ev = SensorEvent{0x30, 0, 0, static_cast<uint32_t>(mm), now};
+    Sim::counters.distanceEvents++;
+    return true;
+}
+
+void SensorController::setDistanceMillimeters(float value) { distanceMmValue = value; }
+float SensorController::distanceMillimeters() { return distanceMmValue; }
+void SensorController::setAmbientLux(float value) { ambientLuxValue = value; }
+float SensorController::ambientLux() { return ambientLuxValue; }
+
+void SensorController::performLuxMeasurement() {
+    Sim::counters.luxReads++;
+    ambientLuxValue = Sim::daylightLux(timers.now());
+}
+
+uint16_t SensorController::restartLuxIntegration() { return 30; }
+
+// ===== Audio: counted, not played =====
+AudioManager audio;
+
+AudioManager::AudioManager() {}
+bool AudioOutputI2S_Metered::begin() { return true; }
+bool AudioOutputI2S_Metered::SetRate(int) { return true; }
+bool AudioOutputI2S_Metered::ConsumeSample(int16_t[2]) { return true; }
+void AudioManager::stop() {}
+void AudioManager::stopPCMClip() {}
+bool AudioManager::isPCMClipActive() const { return false; }
+
+bool AudioManager::startFragment(const AudioFragment &) {
+    Sim::counters.fragmentStarts++;
+    return true;
+}
+
+namespace PlayAudioFragment {
+bool start(const AudioFragment &) {
+    Sim::counters.fragmentStarts++;
+    return true;
+}
+void stop(uint16_t) { Sim::counters.fragmentStops++; }
+} // namespace PlayAudioFragment
+
+namespace PlayPCM {
+bool play(const PCM *, float, uint16_t) {
+    Sim::counters.pcmPings++;
+    return true;
+}
+} // namespace PlayPCM
+
+namespace PlaySentence {
+namespace {
+uint8_t scratchpad[8];
+} // namespace
+void addTTS(const char *) { Sim::counters.ttsSentences++; }
+void addWords(const uint8_t *) { Sim::counters.mp3Sentences++; }
+void forceMaxVolume() {}
+uint8_t *getScratchpad() { return scratchpad; }
+} // namespace PlaySentence
+
+// ===== Audio index: 20 directories of 10 files, 2 minutes each =====
+bool SDController::readDirEntry(uint8_t dir_num, DirEntry *entry) {
+    if (dir_num == 0 || dir_num > 20 || !entry) return false;
+    *entry = DirEntry{10, 10 * 100};
+    return true;
+}
+
+bool SDController::readFileEntry(uint8_t dir_num, uint8_t file_num, FileEntry *entry) {
+    if (dir_num == 0 || dir_num > 20 || file_num == 0 || file_num > 10 || !entry) return false;
+    *entry = FileEntry{2880, 100, 0};  // 120 s at 24 bytes/ms
+    return true;
+}
+
+uint8_t SDController::getHighestDirNum() { return 20; }
+
+namespace SDVoting {
+uint8_t applyVote(uint8_t, uint8_t, int8_t) { return 0; }
+void banFile(uint8_t, uint8_t) {}
+void deleteIndexedFile(uint8_t, uint8_t) {}
+} // namespace SDVoting
+
+// ===== Web, NAS, alerts and the RunManager glue =====
+namespace WebGuiStatus {
+void pushState() { Sim::counters.guiPushes++; }
+} // namespace WebGuiStatus
+
+namespace NasBackup {
+void requestPush(const char *) {}
+} // namespace NasBackup
+
+namespace AlertRGB {
+void startFlashing() {}
+void stopFlashing() {}
+} // namespace AlertRGB
+
+void AlertRun::playWelcomeIfPending() {}
+
+void RunManager::triggerBootFragment() { Sim::counters.bootFragments++; }
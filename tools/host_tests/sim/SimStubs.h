@@ -0,0 +1,50 @@
+/**
+ * @file SimStubs.h
+ * @brief Simulated world behind the run simulation's hardware stand-ins
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * SimStubs.cpp stands in for the modules that drive hardware (audio output,
+ * sensors, RTC clock, web push, NAS) under the Run layer. Time comes from
+ * timers.now(), so a driver that sets a virtual clock on `timers` moves the
+ * wall clock, daylight and visitors with it. Audio is not played: every
+ * request that would start sound is counted instead.
+ */
+#pragma once
+
+#include <Arduino.h>
+
+namespace Sim {
+
+// Simulated day starts at midnight; calendar.csv has an entry with a sentence for it
+constexpr uint16_t START_YEAR = 2026;
+constexpr uint8_t START_MONTH = 10;
+constexpr uint8_t START_DAY = 8;
+constexpr uint8_t START_DOW = 4;  // Thursday (0 = Sunday)
+
+// Someone in front of the dome: distance falls from far to near and back over durationMs
+struct Visit {
+    uint32_t startMs;
+    uint32_t durationMs;
+};
+
+void addVisit(const Visit &visit);
+
+// Ambient light at the sensor for a time of day: dark at night, daylight curve in between
+float daylightLux(uint32_t nowMs);
+
+struct Counters {
+    uint32_t distanceEvents = 0;  // SensorController::readEvent() deliveries
+    uint32_t pcmPings = 0;        // PlayPCM::play()
+    uint32_t fragmentStarts = 0;  // AudioManager::startFragment() / PlayAudioFragment::start()
+    uint32_t fragmentStops = 0;   // PlayAudioFragment::stop()
+    uint32_t ttsSentences = 0;    // PlaySentence::addTTS()
+    uint32_t mp3Sentences = 0;    // PlaySentence::addWords()
+    uint32_t luxReads = 0;        // SensorController::performLuxMeasurement()
+    uint32_t guiPushes = 0;       // WebGuiStatus::pushState()
+    uint32_t bootFragments = 0;   // RunManager::triggerBootFragment()
+};
+
+extern Counters counters;
+
+} // namespace Sim
@@ -0,0 +1,9 @@
+/**
+ * @file mp3dec.h
+ * @brief Host stand-in for the Helix MP3 decoder handle (run simulation)
+ * @version 261016Z
+ * @date 2026-10-16
+ */
+#pragma once
+
+typedef void *HMP3Decoder;
@@ -0,0 +1,123 @@
+/**
+ * @file test_audio_spectrum.cpp
+ * @brief Host test: AudioSpectrum bands, onsets and cost per block
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Pure tones must land in their band, a four-on-the-floor kick over a steady
+ * tone and noise must give one onset per kick, and one block must cost a small
+ * fraction of its own playing time.
+ */
+#include <Arduino.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "AudioSpectrum.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint32_t AUDIO_RATE = 44100;
+
+float kickSample(uint32_t n, uint32_t beatSamples) {
+    const float t = static_cast<float>(n % beatSamples) / AUDIO_RATE;
+    return t < 0.12f ? sinf(2.0f * static_cast<float>(M_PI) * 55.0f * t) * expf(-t * 30.0f) : 0.0f;
+}
+
+// Beat test signal: kick on every beat, 700 Hz tone, soft noise
+std::vector<int16_t> beatSignal(float seconds, float bpm) {
+    std::mt19937 rng(27);
+    std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+    const uint32_t beat = static_cast<uint32_t>(AUDIO_RATE * 60.0f / bpm);
+    std::vector<int16_t> out(static_cast<size_t>(seconds * AUDIO_RATE));
+    for (uint32_t n = 0; n < out.size(); n++) {
+        const float v = 0.6f * kickSample(n, beat) +
+                        0.15f * sinf(2.0f * static_cast<float>(M_PI) * 700.0f * n / AUDIO_RATE) +
+                        0.05f * noise(rng);
+        out[n] = static_cast<int16_t>(v * 32767.0f);
+    }
+    return out;
+}
+
+void checkTones() {
+    struct Tone {
+        float hz;
+        int band;  // 0 bass, 1 mid, 2 high
+    };
+    static const Tone tones[] = {{80.0f, 0}, {1000.0f, 1}, {3200.0f, 2}};
+    static const char *const names[] = {"bass", "mid", "high"};
+    for (const Tone &tone : tones) {
+        AudioSpectrum spectrum;
+        spectrum.setRate(AUDIO_RATE);
+        for (uint32_t n = 0; n < AUDIO_RATE; n++) {
+            spectrum.addSample(static_cast<int16_t>(16000.0f * sinf(2.0f * static_cast<float>(M_PI) * tone.hz * n / AUDIO_RATE)));
+        }
+        const AudioBands b = spectrum.bands();
+        const uint8_t levels[3] = {b.bass, b.mid, b.high};
+        bool pass = levels[tone.band] >= 128;
+        for (int i = 0; i < 3; i++) {
+            if (i != tone.band && levels[i] >= levels[tone.band] / 4) pass = false;
+        }
+        char what[96];
+        snprintf(what, sizeof(what), "%5.0f Hz tone: bass %3u mid %3u high %3u, in %s", tone.hz, b.bass, b.mid,
+                 b.high, names[tone.band]);
+        HostTest::check(what, pass);
+    }
+}
+
+void checkOnsetsAndCost() {
+    constexpr float SECONDS = 10.0f, BPM = 120.0f;
+    const std::vector<int16_t> signal = beatSignal(SECONDS, BPM);
+    AudioSpectrum spectrum;
+    spectrum.setRate(AUDIO_RATE);
+    int onsets = 0;
+    for (int16_t sample : signal) {
+        if (spectrum.addSample(sample) && spectrum.bands().onset == 255) onsets++;
+    }
+    const int beats = static_cast<int>(SECONDS * BPM / 60.0f);
+    char what[96];
+    snprintf(what, sizeof(what), "%.0f bpm kick, %.0f s: %d onsets for %d beats", BPM, SECONDS, onsets, beats);
+    HostTest::check(what, abs(onsets - beats) <= 1);
+
+    constexpr int ROUNDS = 20;
+    uint32_t blocks = 0;
+    volatile uint32_t sink = 0;  // Keeps the results alive under -O2
+    const HostTest::Stopwatch watch;
+#if defined(__x86_64__) || defined(__i386__)
+    const uint64_t tsc = __rdtsc();
+#endif
+    for (int r = 0; r < ROUNDS; r++) {
+        spectrum.reset();
+        for (int16_t sample : signal) {
+            if (spectrum.addSample(sample)) {
+                blocks++;
+                sink = sink + spectrum.bands().bass;
+            }
+        }
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    const double cycles = static_cast<double>(__rdtsc() - tsc) / blocks;
+#endif
+    const double us = watch.us() / blocks;
+    const double blockUs = 1e6 * spectrum.samplesPerBlock() / AUDIO_RATE;
+    printf("host: %.2f us per block of %u samples at %u Hz (%.2f%% of its %.1f ms)", us, spectrum.samplesPerBlock(),
+           AUDIO_RATE, 100.0 * us / blockUs, blockUs / 1000.0);
+#if defined(__x86_64__) || defined(__i386__)
+    printf(", %.0f TSC cycles per block", cycles);
+#endif
+    printf("\n");
+    // A PC core is several times an ESP32 core: 1% here leaves the device well inside its budget
+    HostTest::check("block cost under 1% of its playing time", us <= 0.01 * blockUs);
+}
+
+} // namespace
+
+int main() {
+    checkTones();
+    checkOnsetsAndCost();
+    return HostTest::result();
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test_baked_show.cpp
+ * @brief Host test: baked show decoding and SD streaming next to audio
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Decodes every frame of /light_shows/1.lsb like the player (checksum as
+ * bake_show.py --info, cost per frame). PlayLightShow() only names the show
+ * (it may run in a web handler); the next repaint tick opens it. It plays for
+ * 30 s next to an MP3-rate stand-in stream reading through the same
+ * SDController calls. The player must never underrun. A card model (500 us per read plus 400 kB/s)
+ * prints each stream's share of the card and the show's card time per tick.
+ */
+#include <Arduino.h>
+#include <SD.h>
+#include <vector>
+
+#include "BakedShow.h"
+#include "HostShow.h"
+#include "HostTest.h"
+#include "SDController.h"
+#include "TimerManager.h"
+
+extern bool hostAudioBusy;  // HostStubs: isAudioBusy()
+
+namespace {
+
+constexpr int SHOW_ID = 1;
+constexpr uint32_t PLAY_MS = 30000;
+constexpr uint32_t AUDIO_KBPS = 128;
+constexpr double SD_KBPS = 400.0;    // Card model: sustained read rate ...
+constexpr double SD_READ_US = 500.0; // ... plus command/FAT overhead per read
+
+// Stand-in for AudioFileSourceSD: reads of AUDIO_READ bytes at the MP3 bit rate
+constexpr size_t AUDIO_READ = 1024;
+File audioFile;
+uint32_t audioPos = 0, audioSize = 0, audioReads = 0, audioBytes = 0;
+
+void cb_audioRead() {
+    uint8_t buf[AUDIO_READ];
+    const size_t got = SDController::readStream(audioFile, audioPos, buf, min<size_t>(AUDIO_READ, audioSize - audioPos));
+    audioPos = got && audioPos + got < audioSize ? audioPos + got : 0;
+    audioReads++;
+    audioBytes += got;
+}
+
+double cardUs(uint32_t reads, uint32_t bytes) {
+    return reads * SD_READ_US + bytes * 1000.0 / SD_KBPS;
+}
+
+uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len) {
+    crc = ~crc;
+    while (len--) {
+        crc ^= *data++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+    }
+    return ~crc;
+}
+
+void checkFile(const char *path) {
+    File f = SD.open(path, FILE_READ);
+    std::vector<uint8_t> data(f ? f.size() : 0);
+    if (f) f.read(data.data(), data.size());
+    f.close();
+
+    BakedShow::Header h;
+    if (!HostTest::check("header for this strip", BakedShow::parseHeader(data.data(), data.size(), h) &&
+                                                   h.ledCount == NUM_LEDS)) {
+        return;
+    }
+    uint8_t frame[BakedShow::FRAME_BYTES] = {};
+    uint32_t crc = 0, maxPayload = 0, decoded = 0;
+    size_t pos = BakedShow::HEADER_SIZE;
+    const HostTest::Stopwatch watch;
+    for (; decoded < h.frameCount; decoded++) {
+        const uint16_t len = pos + 2 <= data.size() ? static_cast<uint16_t>(data[pos] | (data[pos + 1] << 8)) : 0;
+        if (pos + 2 + len > data.size() || !BakedShow::decodeFrame(&data[pos + 2], len, frame)) break;
+        crc = crc32(crc, frame, sizeof(frame));
+        maxPayload = max<uint32_t>(maxPayload, len + 2U);
+        pos += 2 + len;
+    }
+    const double us = watch.us();
+    printf("%s: %u frames at %u fps, %.0f bytes per frame (max %u), frames crc32 %08x, decode %.2f us per frame\n",
+           path, h.frameCount, h.fps, static_cast<double>(data.size() - BakedShow::HEADER_SIZE) / h.frameCount,
+           maxPayload, crc, us / max<uint32_t>(decoded, 1));
+    HostTest::check("every frame decodes", decoded == h.frameCount);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *root = HostTest::sdRoot(argc, argv);
+    char path[32];
+    snprintf(path, sizeof(path), "/light_shows/%d.lsb", SHOW_ID);
+    HostShow::begin(root);
+    checkFile(path);
+
+    LightShowParams params;
+    if (!HostTest::check("pattern and colors", HostShow::loadShow(nullptr, nullptr, params))) return 1;
+    params.baked = SHOW_ID;
+    HostShow::play(params, 255);
+    HostTest::check("PlayLightShow() opens no file", BakedShow::activeId() == 0);
+    HostShow::run(100);
+    if (!HostTest::check("repaint tick starts the show", BakedShow::activeId() == SHOW_ID)) return 1;
+
+    audioFile = SDController::openStream(path);  // Any large file stands in for the MP3
+    audioSize = audioFile.size();
+    hostAudioBusy = true;
+    timers.create(max<uint32_t>(1, AUDIO_READ * 8UL / AUDIO_KBPS), 0, cb_audioRead);  // kbit/s = bits per ms
+
+    // The loop core waits for the card, so the worst tick is the longest gap the MP3
+    // decoder's output buffer has to cover because of the show
+    BakedShow::Stats before = BakedShow::stats();
+    double worstTickUs = 0.0;
+    HostShow::run(PLAY_MS, [&](const HostShow::Tick &) {
+        const BakedShow::Stats after = BakedShow::stats();
+        worstTickUs = max(worstTickUs, cardUs(after.reads - before.reads, after.bytesRead - before.bytesRead));
+        before = after;
+    });
+    hostAudioBusy = false;
+
+    const BakedShow::Stats st = BakedShow::stats();
+    const double seconds = PLAY_MS / 1000.0;
+    const double bakedUs = cardUs(st.reads, st.bytesRead);
+    const double audioUs = cardUs(audioReads, audioBytes);
+    printf("baked: %.1f kB/s in %u reads, %u frames, %u underruns, ring low %u bytes\n",
+           st.bytesRead / seconds / 1000.0, st.reads, st.frames, st.underruns, st.ringLow);
+    printf("audio: %.1f kB/s in %u reads\n", audioBytes / seconds / 1000.0, audioReads);
+    printf("card (%.0f kB/s, %.0f us per read): busy %.1f%% (show %.1f%%, audio %.1f%%), "
+           "show reads per tick at most %.2f ms\n", SD_KBPS, SD_READ_US, (bakedUs + audioUs) / (seconds * 1e4),
+           bakedUs / (seconds * 1e4), audioUs / (seconds * 1e4), worstTickUs / 1000.0);
+    HostTest::check("frames played", st.frames > 0);
+    HostTest::check("no underruns next to audio", st.underruns == 0);
+    return HostTest::result();
+}
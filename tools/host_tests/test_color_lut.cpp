@@ -0,0 +1,44 @@
+/**
+ * @file test_color_lut.cpp
+ * @brief Host test: gamma/white-balance LUT against reference curves
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * buildColorLut() against round((v/255)^gamma * white) in double precision,
+ * within one step. The identity setting (gamma 1, white 255) must be exact:
+ * it is the default look.
+ */
+#include <Arduino.h>
+#include <cmath>
+
+#include "LightController.h"
+#include "HostTest.h"
+
+int main() {
+    struct Case {
+        float gamma;
+        uint8_t white[3];
+    };
+    static const Case cases[] = {
+        {1.0f, {255, 255, 255}}, {1.8f, {255, 255, 255}}, {2.2f, {255, 176, 240}},
+        {2.8f, {255, 176, 240}}, {0.5f, {200, 255, 128}},
+    };
+    for (const Case &c : cases) {
+        uint8_t lut[3][256];
+        buildColorLut(lut, c.gamma, c.white);
+        int worst = 0;
+        for (int ch = 0; ch < 3; ch++) {
+            for (int v = 0; v < 256; v++) {
+                int ref = static_cast<int>(std::floor(std::pow(v / 255.0, c.gamma) * c.white[ch] + 0.5));
+                if (ref == 0 && v > 0 && c.white[ch] > 0) ref = 1;
+                worst = max(worst, abs(lut[ch][v] - ref));
+            }
+        }
+        const bool identity = c.gamma == 1.0f && c.white[0] == 255 && c.white[1] == 255 && c.white[2] == 255;
+        char what[80];
+        snprintf(what, sizeof(what), "gamma %.1f white %3u/%3u/%3u: worst difference %d", c.gamma, c.white[0],
+                 c.white[1], c.white[2], worst);
+        HostTest::check(what, identity ? worst == 0 : worst <= 1);
+    }
+    return HostTest::result();
+}
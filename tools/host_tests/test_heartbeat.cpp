@@ -0,0 +1,139 @@
+/**
+ * @file test_heartbeat.cpp
+ * @brief Host test: distance to heartbeat waveform, LED task on the stand-in
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Distance to interval must stay in range, slow down monotonically with
+ * distance and ignore jitter; each interval must give a breath of two
+ * intervals; HeartbeatRun's LED task (tools/light_render/host stand-in on a
+ * virtual clock) must follow setRate and the failure pattern without taking
+ * a timer slot.
+ */
+#include <Arduino.h>
+#include <vector>
+
+#include "Globals.h"
+#include "HeartbeatPolicy.h"
+#include "HeartbeatRun.h"
+#include "HeartbeatLedHost.h"
+#include "TimerManager.h"
+#include "HostTest.h"
+
+extern uint64_t hostHardwareFailBits;  // HostStubs: StatusFlags::getHardwareFailBits()
+
+namespace {
+
+// Rise-to-rise periods of a played trace, skipping the first breath (may straddle a change)
+std::vector<uint32_t> breathPeriods(const std::vector<HostFade> &trace) {
+    std::vector<uint32_t> starts, periods;
+    for (const HostFade &f : trace) {
+        if (f.to > f.from) starts.push_back(f.atMs);
+    }
+    for (size_t i = 2; i < starts.size(); i++) periods.push_back(starts[i] - starts[i - 1]);
+    return periods;
+}
+
+bool periodsEqual(const std::vector<uint32_t> &periods, uint32_t expectMs) {
+    if (periods.empty()) return false;
+    for (uint32_t p : periods) {
+        if (p != expectMs) return false;
+    }
+    return true;
+}
+
+void checkPolicy() {
+    const float minMm = Globals::distanceMinMm, maxMm = Globals::distanceMaxMm;
+    const uint32_t minMs = Globals::heartbeatMinMs, maxMs = Globals::heartbeatMaxMs;
+
+    // Distance sweep past both ends; configure() between steps so jitter suppression stays out
+    bool inRange = true, monotonic = true, rejected = true;
+    uint32_t prev = 0;
+    for (float mm = -100.0f; mm <= maxMm + 500.0f; mm += 5.0f) {
+        HeartbeatPolicy::configure();
+        uint32_t interval = 0;
+        const bool changed = HeartbeatPolicy::intervalFromDistance(mm, interval);
+        if (mm <= 0.0f) {
+            rejected = rejected && !changed;
+            continue;
+        }
+        if (!changed) {
+            inRange = false;
+            continue;
+        }
+        inRange = inRange && interval >= minMs && interval <= maxMs;
+        monotonic = monotonic && interval >= prev;
+        prev = interval;
+    }
+    uint32_t nearMs = 0, farMs = 0;
+    HeartbeatPolicy::configure();
+    HeartbeatPolicy::intervalFromDistance(minMm, nearMs);
+    HeartbeatPolicy::configure();
+    HeartbeatPolicy::intervalFromDistance(maxMm, farMs);
+    printf("distance %.0f..%.0f mm -> %u..%u ms\n", minMm, maxMm, nearMs, farMs);
+    HostTest::check("intervals within heartbeatMinMs..heartbeatMaxMs", inRange);
+    HostTest::check("interval grows with distance", monotonic);
+    HostTest::check("range ends map to the interval ends", nearMs == minMs && farMs == maxMs);
+    HostTest::check("no distance (<= 0) is ignored", rejected);
+
+    // Jitter: a step below 10 ms of interval is not a change, a larger one is
+    uint32_t interval = 0;
+    const float mid = (minMm + maxMm) / 2.0f;
+    const float mmPerMs = (maxMm - minMm) / static_cast<float>(maxMs - minMs);
+    HeartbeatPolicy::configure();
+    HeartbeatPolicy::bootstrap(mid, interval);
+    const bool smallIgnored = !HeartbeatPolicy::intervalFromDistance(mid + 4.0f * mmPerMs, interval);
+    const bool largeTaken = HeartbeatPolicy::intervalFromDistance(mid + 40.0f * mmPerMs, interval);
+    HostTest::check("jitter below 10 ms ignored, larger steps taken", smallIgnored && largeTaken);
+
+    // Waveforms
+    bool waves = true;
+    for (uint32_t ms = 0; ms <= maxMs + 1000; ms += 7) {
+        const HeartbeatWave w = HeartbeatPolicy::waveForInterval(ms, false);
+        const uint32_t half = HeartbeatPolicy::clampInterval(ms);
+        waves = waves && w.riseMs == half && w.fallMs == half && w.darkMs == 0 && w.peak > 0;
+    }
+    const HeartbeatWave fail = HeartbeatPolicy::waveForInterval(500, true);
+    HostTest::check("breath lasts two intervals, no dark", waves);
+    HostTest::check("failure wave: 0.5 s breath, 3 s dark",
+                    fail.riseMs + fail.fallMs == 500 && fail.darkMs == 3000 && fail.peak > 0);
+}
+
+void checkLedTask() {
+    const float minMm = Globals::distanceMinMm, maxMm = Globals::distanceMaxMm;
+    const uint8_t timersBefore = timers.getActiveCount();
+    heartbeatRun.plan();
+    const bool noTimer = timers.getActiveCount() == timersBefore;
+    const std::vector<uint32_t> normal = breathPeriods(hostHeartbeatPlay(10000));
+    const uint32_t defaultMs = HeartbeatPolicy::defaultIntervalMs();
+    printf("default %u ms: period %u ms\n", defaultMs, normal.empty() ? 0 : normal.front());
+    HostTest::check("plan() takes no timer slot", noTimer);
+    HostTest::check("default breath period", periodsEqual(normal, 2 * defaultMs));
+
+    uint32_t interval = 0;
+    HeartbeatPolicy::configure();
+    HeartbeatPolicy::intervalFromDistance(minMm + (maxMm - minMm) / 4.0f, interval);
+    heartbeatRun.setRate(interval);
+    const std::vector<uint32_t> near = breathPeriods(hostHeartbeatPlay(10000));
+    printf("setRate(%u): period %u ms\n", interval, near.empty() ? 0 : near.front());
+    HostTest::check("breath period follows setRate",
+                    periodsEqual(near, 2 * interval) && heartbeatRun.currentRate() == interval);
+
+    hostHardwareFailBits = 1;
+    const std::vector<HostFade> failTrace = hostHeartbeatPlay(20000);
+    hostHardwareFailBits = 0;
+    uint32_t darkMs = 0;
+    for (const HostFade &f : failTrace) {
+        if (f.from == 0 && f.to == 0) darkMs = max<uint32_t>(darkMs, f.ms);
+    }
+    HostTest::check("failing hardware: 3 s dark between breaths",
+                    darkMs == 3000 && periodsEqual(breathPeriods(failTrace), 3500));
+}
+
+} // namespace
+
+int main() {
+    checkPolicy();
+    checkLedTask();
+    return HostTest::result();
+}
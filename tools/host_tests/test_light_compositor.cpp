@@ -0,0 +1,166 @@
+/**
+ * @file test_light_compositor.cpp
+ * @brief Host benchmark: LightCompositor overlay cost per frame, alone and inside the repaint tick
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Four layer setups: none, STATUS with three pixels (AlertRGB's status pixels
+ * at their alpha), ALERT solid (a flash step) and both. For each, compose()
+ * runs COMPOSE_FRAMES times on its own over a strip of the first pattern, and
+ * the first pattern plays for RUN_MS of virtual time at 50 fps through
+ * updateLightController(). Reported: cycles per compose() and per repaint
+ * tick (HostTest::cycles()). Checked: blends and power sums are right, a
+ * layer with a duration expires, no layer costs next to nothing, and both
+ * layers together stay within a tenth of a frame at lightFpsMax.
+ */
+#include <Arduino.h>
+#include <functional>
+
+#include "Globals.h"
+#include "LightCompositor.h"
+#include "LightPower.h"
+#include "Alert/AlertPolicy.h"
+#include "HostShow.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint32_t RUN_MS = 10000;
+constexpr uint16_t FRAME_MS = 20;
+constexpr uint32_t COMPOSE_FRAMES = 20000;
+constexpr uint8_t BRIGHTNESS = 200;
+constexpr uint8_t STATUS_PIXELS = 3;
+
+const CRGB ALERT_COLOR(0xFF, 0x80, 0x00);
+const CRGB STATUS_COLOR(0xFF, 0x00, 0x00);
+
+CRGB base[NUM_LEDS];
+
+struct Setup {
+    const char *name;
+    bool status;
+    bool alert;
+};
+
+constexpr Setup SETUPS[] = {
+    {"none", false, false},
+    {"status", true, false},
+    {"alert", false, true},
+    {"both", true, true},
+};
+
+void apply(const Setup &s) {
+    LightCompositor::clear(LightLayer::STATUS);
+    LightCompositor::clear(LightLayer::ALERT);
+    if (s.status) {
+        for (uint16_t i = 0; i < STATUS_PIXELS; i++) {
+            LightCompositor::setPixel(LightLayer::STATUS, i, STATUS_COLOR, AlertPolicy::STATUS_PIXEL_ALPHA);
+        }
+    }
+    if (s.alert) LightCompositor::setSolid(LightLayer::ALERT, ALERT_COLOR);
+}
+
+LightPower::Sums sumsOf(const CRGB *leds) {
+    LightPower::Sums sums;
+    for (int i = 0; i < NUM_LEDS; i++) sums.add(leds[i]);
+    return sums;
+}
+
+bool sameSums(const LightPower::Sums &a, const LightPower::Sums &b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+// compose() over a copy of base; sums kept in step and checked against a recount
+bool composeBase(CRGB *out) {
+    memcpy(out, base, sizeof(base));
+    LightPower::Sums sums = sumsOf(out);
+    LightCompositor::compose(out, NUM_LEDS, &sums);
+    return sameSums(sums, sumsOf(out));
+}
+
+struct Cost {
+    double composeCycles;  // Per compose() on its own
+    double composeUs;
+    double tickCycles;     // Per repaint tick with the layers set
+};
+
+Cost measure(const Setup &s) {
+    apply(s);
+    static CRGB frame[NUM_LEDS];
+    memcpy(frame, base, sizeof(base));
+    const HostTest::Stopwatch watch;
+    const uint64_t startCycles = HostTest::cycles();
+    for (uint32_t n = 0; n < COMPOSE_FRAMES; n++) LightCompositor::compose(frame, NUM_LEDS);
+    const uint64_t composeCycles = HostTest::cycles() - startCycles;
+    const double composeUs = watch.us();
+
+    uint64_t tickCycles = 0;
+    uint32_t ticks = 0;
+    HostShow::run(RUN_MS, [&](const HostShow::Tick &tick) {
+        tickCycles += tick.renderCycles;
+        ticks++;
+    });
+    return Cost{static_cast<double>(composeCycles) / COMPOSE_FRAMES, composeUs / COMPOSE_FRAMES,
+                static_cast<double>(tickCycles) / max<uint32_t>(ticks, 1)};
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    HostShow::begin(HostTest::sdRoot(argc, argv));
+    LightShowParams params;
+    if (!HostTest::check("first pattern and color set", HostShow::loadShow(nullptr, nullptr, params))) {
+        return HostTest::result();
+    }
+    HostShow::play(params, BRIGHTNESS, FRAME_MS);
+    HostShow::run(1000, [](const HostShow::Tick &tick) { memcpy(base, tick.out, sizeof(base)); });
+
+    // Blends, on a copy of the show's strip
+    CRGB out[NUM_LEDS];
+    apply(SETUPS[0]);
+    bool sumsOk = composeBase(out);
+    HostTest::check("no layer: strip unchanged", memcmp(out, base, sizeof(base)) == 0);
+
+    apply(SETUPS[1]);
+    sumsOk = composeBase(out) && sumsOk;
+    bool statusOk = true;
+    for (int i = 0; i < NUM_LEDS; i++) {
+        CRGB want = base[i];
+        if (i < STATUS_PIXELS) {
+            const uint8_t a = AlertPolicy::STATUS_PIXEL_ALPHA;
+            want = CRGB(lerp8by8(base[i].r, STATUS_COLOR.r, a), lerp8by8(base[i].g, STATUS_COLOR.g, a),
+                        lerp8by8(base[i].b, STATUS_COLOR.b, a));
+        }
+        statusOk = statusOk && out[i] == want;
+    }
+    HostTest::check("status pixels blended, other LEDs untouched", statusOk);
+
+    apply(SETUPS[3]);
+    sumsOk = composeBase(out) && sumsOk;
+    bool alertOk = true;
+    for (int i = 0; i < NUM_LEDS; i++) alertOk = alertOk && out[i] == ALERT_COLOR;
+    HostTest::check("solid alert covers the status pixels and the show", alertOk);
+    HostTest::check("power sums kept in step with every blend", sumsOk);
+
+    apply(SETUPS[0]);
+    LightCompositor::setSolid(LightLayer::ALERT, ALERT_COLOR, 255, BlendMode::NORMAL, 100);
+    HostShow::run(200);
+    HostTest::check("layer with a duration expires", !LightCompositor::isActive(LightLayer::ALERT));
+
+    // Cost
+    printf("layers   compose cycles  compose us  tick cycles\n");
+    Cost costs[sizeof(SETUPS) / sizeof(SETUPS[0])];
+    for (size_t n = 0; n < sizeof(SETUPS) / sizeof(SETUPS[0]); n++) {
+        costs[n] = measure(SETUPS[n]);
+        printf("%-7s  %14.0f  %10.3f  %11.0f\n", SETUPS[n].name, costs[n].composeCycles, costs[n].composeUs,
+               costs[n].tickCycles);
+    }
+    apply(SETUPS[0]);
+    const double budgetUs = 1e6 / max<uint8_t>(Globals::lightFpsMax, 1);
+    printf("%d LEDs; both layers %.3f us per frame (frame budget %.0f us), tick +%.0f cycles\n", NUM_LEDS,
+           costs[3].composeUs, budgetUs, costs[3].tickCycles - costs[0].tickCycles);
+    HostTest::check("no layer: compose() under a tenth of one status layer",
+                    costs[0].composeCycles * 10 < costs[1].composeCycles);
+    HostTest::check("both layers within a tenth of the frame budget", costs[3].composeUs <= budgetUs / 10);
+    return HostTest::result();
+}
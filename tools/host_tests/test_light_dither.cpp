@@ -0,0 +1,155 @@
+/**
+ * @file test_light_dither.cpp
+ * @brief Host test: temporal dithering of dim shows against the 16-bit target, averaged over time
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Two shows at night brightness levels: a still solid color (after the first
+ * frame only dither refreshes change the strip) and the first pattern of the
+ * catalog repainted at 4 fps, well below lightDitherMinFps. Every strip output
+ * is recorded with the 16-bit level it stands for (shown frame x shown
+ * brightness) and held until the next one. Reported per case: outputs per
+ * second and the mean error of the time-averaged output against the
+ * time-averaged target, next to the error of plain rounding. Checked: every
+ * output is the target rounded down or up, the average is within AVG_LSB of
+ * the target and much closer than rounding, output keeps up with
+ * lightDitherMinFps, and with dithering off (255) the output is rounded.
+ */
+#include <Arduino.h>
+#include <cmath>
+#include <vector>
+
+#include "Globals.h"
+#include "HostShow.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint32_t RUN_MS = 10000;
+constexpr uint16_t SLOW_FRAME_MS = 250;
+constexpr float AVG_LSB = 0.02f;  // Mean error of the time-averaged output, in output steps
+
+struct Average {
+    std::vector<double> out, target, rounded;  // Per LED and channel: value x ms, in output steps
+    uint32_t outputs = 0;
+    bool withinStep = true;  // Every output is floor or ceil of its target
+    uint32_t lastMs = 0;
+    std::vector<uint16_t> level;  // 16-bit target of the output on the strip
+    std::vector<uint8_t> shown;
+};
+
+// Close the interval up to atMs: the strip held shown, standing for level
+void hold(Average &a, uint32_t atMs) {
+    const double ms = atMs - a.lastMs;
+    for (size_t n = 0; n < a.shown.size(); n++) {
+        a.out[n] += a.shown[n] * ms;
+        a.target[n] += a.level[n] / 256.0 * ms;
+        a.rounded[n] += ((a.level[n] + 0x80) >> 8) * ms;
+    }
+    a.lastMs = atMs;
+}
+
+struct Result {
+    double outputsPerSec;
+    double ditherLsb;    // Mean |average output - average target|
+    double roundingLsb;  // Same for rounded output
+    bool withinStep;
+};
+
+Result measure(const LightShowParams &params, uint8_t brightness, uint16_t frameMs) {
+    HostShow::play(params, brightness, frameMs);
+    HostShow::run(1000);  // Dither error settled into the show
+
+    Average a;
+    a.out.assign(NUM_LEDS * 3, 0.0);
+    a.target.assign(NUM_LEDS * 3, 0.0);
+    a.rounded.assign(NUM_LEDS * 3, 0.0);
+    a.level.assign(NUM_LEDS * 3, 0);
+    a.shown.assign(NUM_LEDS * 3, 0);
+    a.lastMs = HostShow::now();
+    // The strip as it is now, then every output from here on
+    const CRGB *frame = getShownFrame();
+    for (int i = 0; i < NUM_LEDS; i++) {
+        for (uint8_t c = 0; c < 3; c++) {
+            a.level[i * 3 + c] = frame[i].raw[c] * getShownBrightness();
+            a.shown[i * 3 + c] = leds[i].raw[c];
+        }
+    }
+    const uint32_t startMs = a.lastMs;
+    HostShow::setShowHook([&](uint32_t atMs, const CRGB *out) {
+        hold(a, atMs);
+        const CRGB *f = getShownFrame();
+        const uint8_t b = getShownBrightness();
+        for (int i = 0; i < NUM_LEDS; i++) {
+            for (uint8_t c = 0; c < 3; c++) {
+                const uint16_t level = f[i].raw[c] * b;
+                const uint8_t v = out[i].raw[c];
+                a.withinStep = a.withinStep && (v == level >> 8 || v == (level >> 8) + 1);
+                a.level[i * 3 + c] = level;
+                a.shown[i * 3 + c] = v;
+            }
+        }
+        a.outputs++;
+    });
+    HostShow::run(RUN_MS);
+    HostShow::setShowHook(nullptr);
+    hold(a, startMs + RUN_MS);
+
+    double ditherLsb = 0.0, roundingLsb = 0.0;
+    for (size_t n = 0; n < a.out.size(); n++) {
+        ditherLsb += fabs(a.out[n] - a.target[n]);
+        roundingLsb += fabs(a.rounded[n] - a.target[n]);
+    }
+    const double norm = static_cast<double>(a.out.size()) * RUN_MS;
+    return Result{a.outputs * 1000.0 / RUN_MS, ditherLsb / norm, roundingLsb / norm, a.withinStep};
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    HostShow::begin(HostTest::sdRoot(argc, argv));
+    Globals::lightMorphMs = 0;
+    Globals::maxMilliamps = 60000U;  // Power cap off: shown brightness is the one played
+
+    LightShowParams pattern;
+    if (!HostTest::check("first pattern and color set", HostShow::loadShow(nullptr, nullptr, pattern))) {
+        return HostTest::result();
+    }
+    const LightShowParams solid = MakeSolidParams(CRGB(200, 120, 40));
+
+    struct Case {
+        const char *name;
+        const LightShowParams &params;
+        uint16_t frameMs;
+    };
+    const Case cases[] = {{"still", solid, 1000}, {"slow", pattern, SLOW_FRAME_MS}};
+    const uint8_t levels[] = {3, 7, 12};
+    const uint8_t minFps = Globals::lightDitherMinFps;
+
+    printf("show   brightness  outputs/s  dithered avg err  rounded avg err  (output steps)\n");
+    bool withinStep = true, averaged = true, closer = true, keepsUp = true;
+    for (const Case &c : cases) {
+        for (uint8_t b : levels) {
+            const Result r = measure(c.params, b, c.frameMs);
+            printf("%-5s  %10u  %9.1f  %16.4f  %15.4f\n", c.name, b, r.outputsPerSec, r.ditherLsb, r.roundingLsb);
+            withinStep = withinStep && r.withinStep;
+            averaged = averaged && r.ditherLsb <= AVG_LSB;
+            closer = closer && r.ditherLsb * 5 < r.roundingLsb;
+            keepsUp = keepsUp && r.outputsPerSec >= minFps * 0.9;
+        }
+    }
+
+    Globals::lightDitherMinFps = 255;
+    const Result off = measure(solid, levels[0], 1000);
+    printf("still  %10u  %9.1f  %16.4f  %15.4f  (dithering off)\n", levels[0], off.outputsPerSec, off.ditherLsb,
+           off.roundingLsb);
+    Globals::lightDitherMinFps = minFps;
+
+    HostTest::check("every output is its target rounded down or up", withinStep);
+    HostTest::check("time-averaged output matches the 16-bit target", averaged);
+    HostTest::check("dithered average much closer than rounding", closer);
+    HostTest::check("output keeps up with lightDitherMinFps on still and slow shows", keepsUp);
+    HostTest::check("dithering off: rounded output, resent once a second",
+                    fabs(off.ditherLsb - off.roundingLsb) < 1e-9 && off.outputsPerSec <= 1.5);
+    return HostTest::result();
+}
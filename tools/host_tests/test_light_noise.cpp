@@ -0,0 +1,106 @@
+/**
+ * @file test_light_noise.cpp
+ * @brief Host test: noise field cost and interpolation error per noise pattern
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * LightNoise as renderNoise() drives it, for every pattern of the catalog with
+ * a noise_size: frames at lightFpsMax with the pattern's center drift, the
+ * field sampled every frame vs. keyframes at noise_fps (15 if the pattern has
+ * none) interpolated in between. Fails when a frame takes longer than a frame
+ * at lightFpsMax, or when the interpolated field strays more than one 8-bit
+ * step on average from the one sampled every frame.
+ */
+#include <Arduino.h>
+#include <cmath>
+
+#include "Globals.h"
+#include "LEDMap.h"
+#include "LightNoise.h"
+#include "MathUtils.h"
+#include "PatternCatalog.h"
+#include "HostShow.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr int FRAMES = 3000;
+constexpr double MEAN_STEPS_MAX = 1.0;  // Mean interpolation error, 8-bit field steps
+
+LightNoise::Field fields[2];
+uint16_t out[2][NUM_LEDS];
+
+void checkPattern(const String &id, const LightShowParams &p) {
+    const uint8_t fps[2] = {0, p.noiseFps ? p.noiseFps : static_cast<uint8_t>(15)};
+    const uint32_t frameMs = 1000U / max<uint8_t>(Globals::lightFpsMax, 1);
+    const float xCycleMs = (p.xCycleSec ? p.xCycleSec : 10) * 1000.0f;
+    const float yCycleMs = (p.yCycleSec ? p.yCycleSec : 10) * 1000.0f;
+    uint16_t pixels[NUM_LEDS];
+    for (uint16_t i = 0; i < NUM_LEDS; i++) pixels[i] = i;
+
+    auto pose = [&](int n, uint8_t fieldFps) {
+        const uint32_t atMs = n * frameMs;
+        return LightNoise::Pose{p.noiseSize, p.noiseSpeed,
+                                p.centerX + p.xAmp * sinf(atMs / xCycleMs * MathUtils::k2Pi),
+                                p.centerY + p.yAmp * sinf(atMs / yCycleMs * MathUtils::k2Pi), fieldFps, atMs};
+    };
+
+    double frameUs[2];
+    volatile uint32_t sink = 0;  // Keeps the results alive under -O2
+    for (int m = 0; m < 2; m++) {
+        fields[m] = LightNoise::Field();
+        const HostTest::Stopwatch watch;
+        for (int n = 0; n < FRAMES; n++) {
+            LightNoise::sample(fields[m], pixels, NUM_LEDS, pose(n, fps[m]), out[m]);
+            sink = sink + out[m][n % NUM_LEDS];
+        }
+        frameUs[m] = watch.us() / FRAMES;
+    }
+
+    // Same frames side by side: interpolation error in 8-bit field steps
+    fields[0] = LightNoise::Field();
+    fields[1] = LightNoise::Field();
+    uint32_t worst = 0;
+    uint64_t total = 0;
+    for (int n = 0; n < FRAMES; n++) {
+        for (int m = 0; m < 2; m++) LightNoise::sample(fields[m], pixels, NUM_LEDS, pose(n, fps[m]), out[m]);
+        for (uint16_t i = 0; i < NUM_LEDS; i++) {
+            const uint32_t diff = abs(out[0][i] - out[1][i]);
+            worst = max(worst, diff);
+            total += diff;
+        }
+    }
+    const double meanSteps = total / (256.0 * FRAMES * NUM_LEDS);
+
+    const double budgetUs = 1e6 / max<uint8_t>(Globals::lightFpsMax, 1);
+    printf("pattern %s: cell %.1f, %.2f cells/s, %u frames at %u ms\n", id.c_str(), p.noiseSize, p.noiseSpeed,
+           FRAMES, frameMs);
+    printf("  every frame: %.1f inoise16 per frame, %.1f us per frame\n",
+           fields[0].samples / static_cast<double>(FRAMES), frameUs[0]);
+    printf("  %u fps field: %.1f inoise16 per frame, %.1f us per frame, largest difference %.2f steps (mean %.3f)\n",
+           fps[1], fields[1].samples / static_cast<double>(FRAMES), frameUs[1], worst / 256.0, meanSteps);
+    HostTest::check("  frame within the frame budget", max(frameUs[0], frameUs[1]) <= budgetUs);
+    HostTest::check("  interpolated field close to the sampled one", meanSteps <= MEAN_STEPS_MAX);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    HostShow::begin(HostTest::sdRoot(argc, argv));
+
+    PatternCatalog &patterns = PatternCatalog::instance();
+    const String first = patterns.firstPatternId();
+    String error;
+    int checked = 0;
+    if (!first.isEmpty() && patterns.select(first, error)) {
+        do {
+            LightShowParams params;
+            if (patterns.getParamsForId(patterns.activeId(), params) && params.noiseSize > 0.0f) {
+                checkPattern(patterns.activeId(), params);
+                checked++;
+            }
+        } while (patterns.selectNext(error) && patterns.activeId() != first);
+    }
+    HostTest::check("noise patterns in light_patterns.csv", checked > 0);
+    return HostTest::result();
+}
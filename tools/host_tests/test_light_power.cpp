@@ -0,0 +1,162 @@
+/**
+ * @file test_light_power.cpp
+ * @brief Host test: LED power estimate and limiter against FastLED's power_mgt
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * The reference is FastLED's own power_mgt.cpp (vendor/FastLED, the version
+ * the firmware pins), not a copy of its formula. The frames are recordings:
+ * every baked show of the SD root (/light_shows/N.lsb, rendered offline by
+ * bake_show.py) plus any .lsb given with --frames.
+ *
+ * Per recorded frame, LightPower on its channel sums must give FastLED's
+ * unscaled draw exactly, and the limiter's brightness must keep FastLED's
+ * draw of the scaled frame within the budget without ever going brighter
+ * than FastLED's limiter would. Each show then plays through LightController:
+ * getLedMilliwatts() must match FastLED's draw of every frame sent to the
+ * strip within 1 mW per LED (per-LED rounding and dithering).
+ *
+ * Usage: test_light_power [SDROOT] [--frames FILE.lsb ...]
+ */
+#include <Arduino.h>
+#include <SD.h>
+#include <cstring>
+#include <dirent.h>
+#include <string>
+#include <vector>
+
+#include "BakedShow.h"
+#include "Globals.h"
+#include "LightPower.h"
+#include "HostShow.h"
+#include "HostTest.h"
+#include "power_mgt.h"
+
+namespace {
+
+// One step per channel per LED, well under 1 mW per LED in the model
+constexpr uint32_t TOLERANCE_MW = NUM_LEDS;
+
+uint32_t budgetMw() {
+    return static_cast<uint32_t>(MAX_VOLTS) * Globals::maxMilliamps;
+}
+
+bool readFrames(const std::string &path, std::vector<std::vector<CRGB>> &out) {
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) return false;
+    std::vector<uint8_t> data;
+    uint8_t buf[4096];
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), fp)) > 0;) data.insert(data.end(), buf, buf + n);
+    fclose(fp);
+
+    BakedShow::Header h;
+    if (!BakedShow::parseHeader(data.data(), data.size(), h) || h.ledCount != NUM_LEDS) return false;
+    uint8_t frame[BakedShow::FRAME_BYTES] = {};
+    size_t pos = BakedShow::HEADER_SIZE;
+    out.clear();
+    for (uint32_t n = 0; n < h.frameCount; n++) {
+        const uint16_t len = pos + 2 <= data.size() ? static_cast<uint16_t>(data[pos] | (data[pos + 1] << 8)) : 0;
+        if (pos + 2 + len > data.size() || !BakedShow::decodeFrame(&data[pos + 2], len, frame)) return false;
+        std::vector<CRGB> leds(NUM_LEDS);
+        memcpy(leds.data(), frame, sizeof(frame));
+        out.push_back(leds);
+        pos += 2 + len;
+    }
+    return !out.empty();
+}
+
+void checkRecording(const std::string &name, const std::vector<std::vector<CRGB>> &frames) {
+    const uint32_t budget = budgetMw();
+    uint32_t unscaledDiffs = 0, overBudget = 0, brighter = 0, limited = 0, peakMw = 0, worstOverMw = 0;
+    for (const std::vector<CRGB> &leds : frames) {
+        LightPower::Sums sums;
+        for (const CRGB &c : leds) sums.add(c);
+        const uint32_t reference = calculate_unscaled_power_mW(leds.data(), NUM_LEDS);
+        if (LightPower::unscaledMilliwatts(sums, NUM_LEDS) != reference) unscaledDiffs++;
+        peakMw = max(peakMw, reference);
+
+        const uint8_t ours = LightPower::maxBrightness(sums, NUM_LEDS, 255, budget);
+        const uint8_t fastled = calculate_max_brightness_for_power_mW(leds.data(), NUM_LEDS, 255, budget);
+        if (ours < 255) limited++;
+        if (ours > fastled) brighter++;
+        std::vector<CRGB> scaled(leds);
+        for (CRGB &c : scaled) c.nscale8(ours);
+        const uint32_t drawn = calculate_unscaled_power_mW(scaled.data(), NUM_LEDS);
+        if (drawn > budget + TOLERANCE_MW) {
+            overBudget++;
+            worstOverMw = max(worstOverMw, drawn - budget);
+        }
+    }
+    printf("%s: %zu recorded frames, peak %u mW unscaled, %u limited to the %u mW budget\n", name.c_str(),
+           frames.size(), peakMw, limited, budget);
+    HostTest::check(("  " + name + " unscaled draw equals FastLED's").c_str(), unscaledDiffs == 0);
+    printf("  limited frames above budget: %u (worst %u mW over)\n", overBudget, worstOverMw);
+    HostTest::check(("  " + name + " limiter keeps FastLED's draw in budget").c_str(), overBudget == 0);
+    HostTest::check(("  " + name + " limiter never brighter than FastLED's").c_str(), brighter == 0);
+}
+
+void checkPlayback(const std::string &name, uint8_t id, uint32_t ms) {
+    LightShowParams params;
+    if (!HostShow::loadShow(nullptr, nullptr, params)) return;
+    params.baked = id;
+    HostShow::play(params, 255);
+    HostShow::run(100);  // The repaint tick starts the show
+    if (!HostTest::check(("  " + name + " plays").c_str(), BakedShow::activeId() == id)) return;
+
+    const uint32_t budget = budgetMw();
+    uint32_t compared = 0, worstDiff = 0, worstRef = 0, peakRef = 0;
+    HostShow::run(ms, [&](const HostShow::Tick &t) {
+        if (!t.shown) return;
+        const uint32_t reference = calculate_unscaled_power_mW(t.out, NUM_LEDS);
+        const uint32_t estimate = getLedMilliwatts();
+        const uint32_t diff = estimate > reference ? estimate - reference : reference - estimate;
+        if (diff >= worstDiff) {
+            worstDiff = diff;
+            worstRef = reference;
+        }
+        peakRef = max(peakRef, reference);
+        compared++;
+    });
+    printf("  played %u frames: peak %u mW (budget %u), worst estimate difference %u mW at %u mW\n", compared,
+           peakRef, budget, worstDiff, worstRef);
+    HostTest::check(("  " + name + " estimate matches FastLED on the strip output").c_str(),
+                    compared > 0 && worstDiff <= TOLERANCE_MW);
+    HostTest::check(("  " + name + " strip output within budget").c_str(), peakRef <= budget + TOLERANCE_MW);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *root = HostTest::sdRoot(argc, argv);
+    HostShow::begin(root);
+
+    // Baked shows of the SD root (played too), then --frames recordings
+    std::vector<std::string> shows;
+    if (DIR *dir = opendir((std::string(root) + "/light_shows").c_str())) {
+        while (const dirent *e = readdir(dir)) {
+            const std::string n = e->d_name;
+            if (n.size() > 4 && n.compare(n.size() - 4, 4, ".lsb") == 0) shows.push_back(n);
+        }
+        closedir(dir);
+    }
+    std::vector<std::string> extra;
+    for (int i = 2; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0) extra.push_back(argv[++i]);
+    }
+    HostTest::check("recorded frames to check", !shows.empty() || !extra.empty());
+
+    std::vector<std::vector<CRGB>> frames;
+    for (const std::string &n : shows) {
+        if (!HostTest::check(("light_shows/" + n + " readable").c_str(),
+                             readFrames(std::string(root) + "/light_shows/" + n, frames))) {
+            continue;
+        }
+        checkRecording(n, frames);
+        const int id = atoi(n.c_str());
+        if (id > 0 && id <= 255) checkPlayback(n, static_cast<uint8_t>(id), 10000);
+    }
+    for (const std::string &path : extra) {
+        if (HostTest::check((path + " readable").c_str(), readFrames(path, frames))) checkRecording(path, frames);
+    }
+    return HostTest::result();
+}
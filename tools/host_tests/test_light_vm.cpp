@@ -0,0 +1,209 @@
+/**
+ * @file test_light_vm.cpp
+ * @brief Host test: light programs, cost per frame, non-finite results, reload
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Every compiled program of the SD root (/light_programs/N.lpb) runs the same
+ * per-LED loop as the firmware's renderProgram() and must fit a frame at
+ * lightFpsMax. Hand-assembled programs that overflow to Inf and NaN must come
+ * out of run() as 0, sin/cos of them included. A program refused at load stays
+ * refused until the catalogs reload (forgetRefused()), then loads from a fixed
+ * file without a reboot. PlayLightShow() reads no program (it may run in a web
+ * handler): the next repaint tick on the loop loads it.
+ */
+#include <Arduino.h>
+#include <cmath>
+#include <cstring>
+#include <dirent.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Globals.h"
+#include "LEDMap.h"
+#include "LightVM.h"
+#include "HostShow.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint8_t RELOAD_ID = LightVM::PROGRAM_SLOTS - 1;  // Unused by the fixture programs
+
+bool readFile(const std::string &path, std::vector<uint8_t> &out) {
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) return false;
+    uint8_t buf[512];
+    out.clear();
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), fp)) > 0;) out.insert(out.end(), buf, buf + n);
+    fclose(fp);
+    return true;
+}
+
+bool writeFile(const std::string &path, const std::vector<uint8_t> &data) {
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (!fp) return false;
+    const bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    fclose(fp);
+    return ok;
+}
+
+void benchProgram(const std::string &name, const std::vector<uint8_t> &data) {
+    LightVM::Program prog;
+    if (!HostTest::check((name + " parses within the instruction budget").c_str(),
+                         LightVM::parse(data.data(), data.size(), prog))) {
+        return;
+    }
+    const float *xs = getLEDMapX();
+    const float *ys = getLEDMapY();
+    float in[LightVM::IN_COUNT] = {};
+    in[LightVM::IN_RADIUS] = 20.0f;
+    in[LightVM::IN_FADE_WIDTH] = 16.0f;
+    volatile float sink = 0.0f;  // Keeps the results alive under -O2
+
+    constexpr int FRAMES = 2000;
+    const HostTest::Stopwatch watch;
+    for (int n = 0; n < FRAMES; n++) {
+        in[LightVM::IN_COLOR_PHASE] = in[LightVM::IN_BRIGHT_PHASE] = (n & 0xFF) / 256.0f;
+        in[LightVM::IN_AUDIO] = (n % 100) / 100.0f;
+        for (int i = 0; i < NUM_LEDS; i++) {
+            in[LightVM::IN_X] = xs[i];
+            in[LightVM::IN_Y] = ys[i];
+            in[LightVM::IN_DIST] = sqrtf(xs[i] * xs[i] + ys[i] * ys[i]);
+            in[LightVM::IN_INDEX] = i / static_cast<float>(NUM_LEDS);
+            const LightVM::Result r = LightVM::run(prog, in);
+            sink = sink + r.index + r.bright;
+        }
+    }
+    const double us = watch.us();
+    const double frameUs = us / FRAMES;
+    const double budgetUs = 1e6 / max<uint8_t>(Globals::lightFpsMax, 1);
+    const uint32_t perFrame = static_cast<uint32_t>(prog.ops) * NUM_LEDS;
+    printf("%s: %u instructions per LED, %u per frame (budget %u)\n", name.c_str(), prog.ops, perFrame,
+           Globals::lightProgramBudget);
+    printf("host: %.1f us per frame of %d LEDs, %.1f ns per instruction (frame budget %.0f us)\n", frameUs,
+           NUM_LEDS, us * 1000.0 / (static_cast<double>(perFrame) * FRAMES), budgetUs);
+    HostTest::check((name + " frame within the frame budget").c_str(), frameUs <= budgetUs);
+}
+
+// Bytecode builder for the hand-assembled programs
+struct Asm {
+    std::vector<uint8_t> bytes{LightVM::MAGIC[0], LightVM::MAGIC[1], LightVM::MAGIC[2], LightVM::MAGIC[3], 0};
+
+    Asm &push(float v) {
+        bytes.push_back(LightVM::OP_PUSH);
+        uint8_t raw[sizeof(float)];
+        memcpy(raw, &v, sizeof(raw));
+        bytes.insert(bytes.end(), raw, raw + sizeof(raw));
+        return *this;
+    }
+    Asm &op(LightVM::Op o) {
+        bytes.push_back(o);
+        return *this;
+    }
+    std::vector<uint8_t> done() {
+        bytes[sizeof(LightVM::MAGIC)] = static_cast<uint8_t>(bytes.size() - sizeof(LightVM::MAGIC) - 1);
+        return bytes;
+    }
+};
+
+void checkNonFinite() {
+    using namespace LightVM;
+    const float inf = std::numeric_limits<float>::infinity();
+    struct Case {
+        const char *what;
+        std::vector<uint8_t> code;
+        float index, bright;  // Expected
+    };
+    const Case cases[] = {
+        {"overflow to Inf", Asm().push(3e38f).push(3e38f).op(OP_MUL).op(OP_INDEX)
+                                 .push(-3e38f).push(3e38f).op(OP_MUL).op(OP_BRIGHT).done(), 0.0f, 0.0f},
+        {"Inf - Inf = NaN", Asm().push(inf).push(inf).op(OP_SUB).op(OP_INDEX)
+                                 .push(inf).push(0.0f).op(OP_MUL).op(OP_BRIGHT).done(), 0.0f, 0.0f},
+        // sin(0) and cos(0) (sin16 of a quarter turn): the arguments became 0 before the lookup
+        {"sin/cos of Inf and NaN", Asm().push(inf).op(OP_SIN).op(OP_INDEX)
+                                        .push(inf).push(inf).op(OP_SUB).op(OP_COS).op(OP_BRIGHT).done(), 0.0f,
+         sin16(16384) / 32768.0f},
+        {"fract/floor of Inf", Asm().push(inf).op(OP_FRACT).op(OP_INDEX).push(-inf).op(OP_FLOOR).op(OP_BRIGHT).done(),
+         0.0f, 0.0f},
+    };
+    const float in[IN_COUNT] = {};
+    for (const Case &c : cases) {
+        Program prog;
+        const bool parsed = parse(c.code.data(), c.code.size(), prog);
+        const Result r = parsed ? run(prog, in) : Result{-1.0f, -1.0f};
+        char what[96];
+        snprintf(what, sizeof(what), "%s: index %g, bright %g", c.what, r.index, r.bright);
+        HostTest::check(what, parsed && r.index == c.index && r.bright == c.bright);
+    }
+}
+
+void checkReload(const std::string &root, const std::vector<uint8_t> &valid) {
+    char name[32];
+    snprintf(name, sizeof(name), "/light_programs/%u.lpb", RELOAD_ID);
+    const std::string path = root + name;
+    remove(path.c_str());
+    const bool missing = !LightVM::load(RELOAD_ID) && !LightVM::get(RELOAD_ID);
+
+    std::vector<uint8_t> broken = valid;
+    broken[0] = 'X';  // Bad magic
+    writeFile(path, broken);
+    LightVM::forgetRefused();
+    const bool refused = !LightVM::load(RELOAD_ID) && !LightVM::get(RELOAD_ID);
+
+    writeFile(path, valid);
+    const bool sticky = !LightVM::load(RELOAD_ID) && !LightVM::get(RELOAD_ID);
+    LightVM::forgetRefused();
+    const bool loaded = LightVM::load(RELOAD_ID) && LightVM::get(RELOAD_ID) != nullptr;
+    remove(path.c_str());
+    HostTest::check("missing, then refused, then fixed program loads without a reboot", missing && refused && loaded);
+    HostTest::check("refused program not read again before the catalogs reload", sticky);
+}
+
+// A show naming a program not loaded yet: PlayLightShow() leaves the read to the repaint tick
+void checkPlayDefersLoad(const std::string &root, const std::vector<uint8_t> &valid) {
+    constexpr uint8_t PLAY_ID = RELOAD_ID - 1;
+    char name[32];
+    snprintf(name, sizeof(name), "/light_programs/%u.lpb", PLAY_ID);
+    const std::string path = root + name;
+    writeFile(path, valid);
+    LightShowParams params = MakeSolidParams(CRGB(200, 120, 40));
+    params.program = PLAY_ID;
+    HostShow::play(params, 200);  // PlayLightShow(), no repaint tick yet
+    const bool deferred = LightVM::get(PLAY_ID) == nullptr;
+    HostShow::run(100);
+    const bool loaded = LightVM::get(PLAY_ID) != nullptr;
+    remove(path.c_str());
+    HostTest::check("PlayLightShow() reads no program; the repaint tick loads it", deferred && loaded);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::string root = HostTest::sdRoot(argc, argv);
+    HostShow::begin(root.c_str());
+
+    std::vector<std::string> names;
+    if (DIR *dir = opendir((root + "/light_programs").c_str())) {
+        while (const dirent *e = readdir(dir)) {
+            const std::string n = e->d_name;
+            if (n.size() > 4 && n.compare(n.size() - 4, 4, ".lpb") == 0) names.push_back(n);
+        }
+        closedir(dir);
+    }
+    std::vector<uint8_t> data, firstValid;
+    for (const std::string &n : names) {
+        if (!readFile(root + "/light_programs/" + n, data)) continue;
+        benchProgram(n, data);
+        LightVM::Program prog;
+        if (firstValid.empty() && LightVM::parse(data.data(), data.size(), prog)) firstValid = data;
+    }
+    HostTest::check("compiled programs in light_programs", !names.empty());
+
+    checkNonFinite();
+    if (!firstValid.empty()) {
+        checkReload(root, firstValid);
+        checkPlayDefersLoad(root, firstValid);
+    }
+    return HostTest::result();
+}
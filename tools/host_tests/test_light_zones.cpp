@@ -0,0 +1,209 @@
+/**
+ * @file test_light_zones.cpp
+ * @brief Host test: zone pixel lists on ledmap.bin against a reference
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * LightZones::buildPixelLists on the loaded map against a reference in double
+ * precision: ranges directly, sectors with atan2, polygons by winding number.
+ * The lists must cover every LED exactly once. An LED within ZONE_EDGE map
+ * units of a boundary may go either way in float and is only reported.
+ *
+ * Runs on a built-in fixture set (every shape, overlaps, an off-center sector,
+ * a wedge reaching past the rim) so the check never depends on what the
+ * shipped light_zones.csv enables, then on the zones of light_zones.csv when it
+ * has any. Each set prints the LEDs of every zone for the loaded map.
+ */
+#include <Arduino.h>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "LEDMap.h"
+#include "LightZones.h"
+#include "ZoneTable.h"
+#include "HostShow.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr double ZONE_EDGE = 1e-3;
+
+struct FixtureZone {
+    const char *name, *shape, *region;
+};
+
+// Same syntax as light_zones.csv (shape and region columns)
+const FixtureZone FIXTURE[] = {
+    {"Noord", "angle", "45 135"},
+    {"Rand", "range", "120-159"},
+    {"Midden", "polygon", "-20 -20 20 -20 20 20 -20 20"},
+    {"Uit", "angle", "300 330"},
+    {"Wig", "polygon", "0 0 60 -10 60 10"},
+    {"Rond", "angle", "200 250 10 10"},
+};
+
+double segmentDistance(double px, double py, double ax, double ay, double bx, double by) {
+    const double dx = bx - ax, dy = by - ay;
+    const double len2 = dx * dx + dy * dy;
+    double t = len2 > 0.0 ? ((px - ax) * dx + (py - ay) * dy) / len2 : 0.0;
+    t = t < 0.0 ? 0.0 : t > 1.0 ? 1.0 : t;
+    return std::hypot(px - (ax + t * dx), py - (ay + t * dy));
+}
+
+// Reference membership; edge is set when the LED lies on the boundary within ZONE_EDGE
+bool referenceContains(const LightZones::Region &r, int index, double x, double y, bool &edge) {
+    edge = false;
+    switch (r.shape) {
+        case LightZones::Shape::RANGE:
+            for (int i = 0; i < r.count; i++) {
+                if (index >= r.first[i] && index <= r.last[i]) return true;
+            }
+            return false;
+
+        case LightZones::Shape::ANGLE: {
+            if (r.spanDeg >= 360.0f) return true;
+            const double dx = x - r.cx, dy = y - r.cy;
+            double offset = std::atan2(dy, dx) * 180.0 / M_PI - r.fromDeg;
+            offset -= 360.0 * std::floor(offset / 360.0);
+            // Distance to the nearer boundary ray, in map units
+            const double toStart = std::min(offset, 360.0 - offset);
+            const double toEnd = std::fabs(offset - r.spanDeg);
+            edge = std::hypot(dx, dy) * std::sin(std::min(std::min(toStart, toEnd), 90.0) * M_PI / 180.0) < ZONE_EDGE;
+            return offset <= r.spanDeg;
+        }
+
+        case LightZones::Shape::POLYGON: {
+            int winding = 0;
+            for (int i = 0; i < r.count; i++) {
+                const int j = (i + 1) % r.count;
+                const double ax = r.x[i], ay = r.y[i], bx = r.x[j], by = r.y[j];
+                if (segmentDistance(x, y, ax, ay, bx, by) < ZONE_EDGE) edge = true;
+                const double side = (bx - ax) * (y - ay) - (x - ax) * (by - ay);
+                if (ay <= y && by > y && side > 0.0) winding++;
+                else if (ay > y && by <= y && side < 0.0) winding--;
+            }
+            return winding != 0;
+        }
+    }
+    return false;
+}
+
+// "0-12,150-159" for a sorted index list
+std::string indexRanges(const uint16_t *pixels, uint16_t count) {
+    std::string out;
+    for (uint16_t n = 0; n < count;) {
+        uint16_t m = n;
+        while (m + 1 < count && pixels[m + 1] == pixels[m] + 1) m++;
+        if (!out.empty()) out += ",";
+        out += std::to_string(pixels[n]);
+        if (m > n) out += "-" + std::to_string(pixels[m]);
+        n = m + 1;
+    }
+    return out.empty() ? "-" : out;
+}
+
+// fixture: the built-in set, where every zone must also hold at least one LED
+void checkZones(const char *set, const LightZones::Region *const *regions, const std::vector<String> &names,
+                bool fixture) {
+    const uint8_t count = static_cast<uint8_t>(names.size());
+    const float *xs = getLEDMapX();
+    const float *ys = getLEDMapY();
+    LightZones::PixelLists lists;
+    LightZones::buildPixelLists(regions, count, xs, ys, lists);
+
+    // The lists must cover every LED exactly once, in index order per owner
+    bool once = lists.start[0] == 0 && lists.start[count + 1] == NUM_LEDS;
+    int owner[NUM_LEDS];
+    std::fill(owner, owner + NUM_LEDS, -1);
+    for (uint8_t z = 0; once && z <= count; z++) {
+        for (uint16_t n = lists.start[z]; n < lists.start[z + 1]; n++) {
+            const uint16_t i = lists.pixels[n];
+            if (i >= NUM_LEDS || owner[i] != -1 || (n > lists.start[z] && i <= lists.pixels[n - 1])) once = false;
+            else owner[i] = z;
+        }
+    }
+    printf("%s: map v%u, %u zones\n", set, getLEDMapVersion(), count);
+    if (!HostTest::check("  pixel lists cover each LED once", once)) return;
+
+    int mismatches = 0, edges = 0;
+    for (int i = 0; i < NUM_LEDS; i++) {
+        int expect = 0;
+        bool nearEdge = false;
+        for (uint8_t z = 0; z < count; z++) {
+            bool edge;
+            if (referenceContains(*regions[z], i, xs[i], ys[i], edge)) expect = z + 1;
+            nearEdge = nearEdge || edge;
+        }
+        if (owner[i] == expect) continue;
+        if (nearEdge) {
+            edges++;
+            printf("  LED %d at (%.3f, %.3f): on a zone boundary, renderer %d, reference %d\n", i, xs[i], ys[i],
+                   owner[i], expect);
+            continue;
+        }
+        mismatches++;
+        printf("  LED %d at (%.3f, %.3f): renderer zone %d, reference zone %d\n", i, xs[i], ys[i], owner[i], expect);
+    }
+
+    bool everyZoneLit = true;
+    for (uint8_t z = 0; z <= count; z++) {
+        const uint16_t n = lists.start[z + 1] - lists.start[z];
+        const std::string leds = indexRanges(lists.pixels + lists.start[z], n);
+        if (z == 0) {
+            printf("  main show            %3u LEDs  %s\n", n, leds.c_str());
+        } else {
+            printf("  %u %-10s %-7s %3u LEDs  %s\n", z, names[z - 1].c_str(),
+                   LightZones::shapeName(regions[z - 1]->shape), n, leds.c_str());
+        }
+    }
+    for (uint8_t z = 0; z < count; z++) {
+        bool any = false;
+        for (int i = 0; i < NUM_LEDS && !any; i++) {
+            bool edge;
+            any = referenceContains(*regions[z], i, xs[i], ys[i], edge);
+        }
+        everyZoneLit = everyZoneLit && any;
+    }
+    printf("  %d LEDs checked, %d on a boundary, %d mismatches\n", NUM_LEDS, edges, mismatches);
+    HostTest::check("  renderer matches the reference", mismatches == 0);
+    if (fixture) HostTest::check("  every fixture zone holds LEDs", everyZoneLit);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *root = HostTest::sdRoot(argc, argv);
+    if (!HostTest::check("ledmap.bin loaded", HostShow::begin(root))) return 1;
+
+    // Built-in fixture
+    std::vector<LightZones::Region> fixture(sizeof(FIXTURE) / sizeof(FIXTURE[0]));
+    std::vector<const LightZones::Region *> regions;
+    std::vector<String> names;
+    bool parsed = true;
+    for (size_t z = 0; z < fixture.size(); z++) {
+        const char *error = nullptr;
+        if (!LightZones::parseRegion(FIXTURE[z].shape, FIXTURE[z].region, fixture[z], error)) {
+            printf("fixture zone %s: %s\n", FIXTURE[z].name, error);
+            parsed = false;
+        }
+        regions.push_back(&fixture[z]);
+        names.push_back(FIXTURE[z].name);
+    }
+    if (HostTest::check("fixture zones parse", parsed)) checkZones("fixture", regions.data(), names, true);
+
+    // Whatever light_zones.csv enables (the shipped file has examples only)
+    const ZoneTable &table = ZoneTable::instance();
+    if (table.zoneCount() == 0) {
+        printf("%s/light_zones.csv: no active zones\n", root);
+        return HostTest::result();
+    }
+    regions.clear();
+    names.clear();
+    for (size_t z = 0; z < table.zoneCount(); z++) {
+        regions.push_back(&table.zones()[z].region);
+        names.push_back(table.zoneName(z));
+    }
+    checkZones("light_zones.csv", regions.data(), names, false);
+    return HostTest::result();
+}
@@ -0,0 +1,141 @@
+/**
+ * @file test_lux_self_light.cpp
+ * @brief Host test: LED self-light model on blanked lux measurements
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * A blanked measurement gives the lit reading, the dark one right after it and
+ * the LED light power. Replayed in order, each is first predicted from the model
+ * learned so far (what a measurement without blanking would report), then
+ * learned from. The corrected readings must halve the lux error of the raw ones
+ * and not add brightness steps; the blanking cadence must follow luxBlankEvery.
+ *
+ * The measurements come from a device serial log ("[LightRun] Lux blanked"
+ * lines) given with --lux-log FILE. Without one the test replays a synthetic
+ * log and says so on every line it prints: that run only shows the model
+ * converges on data shaped like the sensor's, not that it fits a real dome.
+ *
+ * Usage: test_lux_self_light [--lux-log FILE]
+ */
+#include <Arduino.h>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Globals.h"
+#include "LightPolicy.h"
+#include "HostTest.h"
+
+namespace {
+
+struct LuxSample {
+    float lit, dark;
+    uint32_t ledMw;
+};
+
+// "[LightRun] Lux blanked: lit=.. dark=.. led=..mW" lines of a serial log
+bool readLuxLog(const char *path, std::vector<LuxSample> &out) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        const char *p = strstr(line, "Lux blanked: ");
+        LuxSample s;
+        unsigned long mw;
+        if (p && sscanf(p, "Lux blanked: lit=%f dark=%f led=%lumW", &s.lit, &s.dark, &mw) == 3) {
+            s.ledMw = static_cast<uint32_t>(mw);
+            out.push_back(s);
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+// Stand-in log: ambient drifting from dusk to daylight, a pattern change every few
+// measurements (each lights the sensor differently per watt), sensor counts of 0.115 lux
+std::vector<LuxSample> syntheticLuxLog() {
+    constexpr float LUX_PER_COUNT = 0.1152f;
+    std::mt19937 rng(27);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    auto counts = [&](float lux) { return std::floor(lux / LUX_PER_COUNT + 0.5f) * LUX_PER_COUNT; };
+    std::vector<LuxSample> out;
+    float logAmbient = logf(3.0f), luxPerWatt = 3.0f, fullMw = 6000.0f;
+    for (int n = 0; n < 300; n++) {
+        logAmbient = clamp(logAmbient + 0.03f + 0.15f * noise(rng), logf(0.5f), logf(700.0f));
+        if (n % 6 == 0) {
+            luxPerWatt = 3.0f * (0.85f + 0.3f * unit(rng));
+            fullMw = 1000.0f + 11000.0f * unit(rng);
+        }
+        const float mw = fullMw * (0.6f + 0.4f * unit(rng));  // Brightness cycle and audio
+        const float ambient = expf(logAmbient);
+        LuxSample s;
+        s.ledMw = static_cast<uint32_t>(mw);
+        s.dark = counts(ambient * (1.0f + 0.01f * noise(rng)));
+        s.lit = counts(ambient * (1.0f + 0.01f * noise(rng)) + luxPerWatt * mw / 1000.0f);
+        out.push_back(s);
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *logPath = nullptr;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--lux-log") == 0) logPath = argv[i + 1];
+    }
+
+    std::vector<LuxSample> samples;
+    std::string source;
+    if (logPath) {
+        if (!HostTest::check("device log readable", readLuxLog(logPath, samples))) return 1;
+        source = std::string("device log ") + logPath;
+    } else {
+        samples = syntheticLuxLog();
+        source = "SYNTHETIC log, not device data";
+        printf("no --lux-log FILE: replaying a synthetic log. Record a device log (serial output with\n"
+               "\"[LightRun] Lux blanked\" lines) and pass it to check the model against a real dome.\n");
+    }
+    printf("%zu blanked measurements from the %s\n", samples.size(), source.c_str());
+
+    LightPolicy::SelfLightModel model;
+    double rawLux = 0, modelLux = 0, rawSteps = 0, modelSteps = 0;
+    float worstLux = 0;
+    int worstSteps = 0, predicted = 0;
+    for (const LuxSample &s : samples) {
+        if (model.samples > 0 && s.ledMw > 0) {
+            const float est = LightPolicy::subtractSelfLight(model, s.lit, s.ledMw);
+            const int truth = LightPolicy::calcShiftedHi(s.dark, 0, 1.0f);
+            const int estHi = LightPolicy::calcShiftedHi(est, 0, 1.0f);
+            rawLux += fabsf(s.lit - s.dark);
+            modelLux += fabsf(est - s.dark);
+            rawSteps += abs(LightPolicy::calcShiftedHi(s.lit, 0, 1.0f) - truth);
+            modelSteps += abs(estHi - truth);
+            worstLux = max(worstLux, fabsf(est - s.dark));
+            worstSteps = max(worstSteps, abs(estHi - truth));
+            predicted++;
+        }
+        LightPolicy::learnSelfLight(model, s.lit, s.dark, s.ledMw);
+    }
+    if (!HostTest::check("measurements to predict", predicted > 0)) return 1;
+
+    printf("model %.2f lux/W after %u samples\n", model.luxPerWatt, model.samples);
+    printf("uncorrected: mean error %.2f lux, %.2f brightness steps\n", rawLux / predicted, rawSteps / predicted);
+    printf("corrected:   mean error %.2f lux (worst %.2f), %.2f brightness steps (worst %d)\n",
+           modelLux / predicted, worstLux, modelSteps / predicted, worstSteps);
+    const std::string what = "self-light model (" + source + ")";
+    HostTest::check(what.c_str(), modelLux <= 0.5 * rawLux && modelSteps <= rawSteps);
+
+    // Blanking cadence: first lit measurement, then every luxBlankEvery; never while (almost) dark
+    LightPolicy::SelfLightModel fresh;
+    bool cadence = LightPolicy::luxNeedsBlanking(fresh, 7, 5000) && !LightPolicy::luxNeedsBlanking(fresh, 0, 100);
+    int blanks = 0;
+    for (uint32_t n = 0; n < 100; n++) blanks += LightPolicy::luxNeedsBlanking(model, n, 5000);
+    const int expect = Globals::luxBlankEvery ? (100 + Globals::luxBlankEvery - 1) / Globals::luxBlankEvery : 0;
+    printf("blanking: %d of 100 measurements (luxBlankEvery %u)\n", blanks, Globals::luxBlankEvery);
+    HostTest::check("blanking cadence", cadence && blanks == expect);
+    return HostTest::result();
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_seqlock.cpp
+ * @brief Host test: Seqlock handoff under std::thread, one writer and several readers
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * The payload has the layout of LightController's RenderFrame (show params,
+ * phases, brightness, audio bands, morph and baked state, frame time), every
+ * field derived from the frame number. One thread publishes frames as fast as
+ * it can, READERS threads read them back for RUN_MS of wall time. Checked:
+ * every snapshot is one whole frame (no field from another write), its number
+ * matches the sequence read() returned, and each reader only ever moves
+ * forward. Tearing shows up even on a single core, where the writer is
+ * preempted mid-write: with read()'s sequence re-check removed, a run reports
+ * torn frames.
+ */
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "AudioState.h"
+#include "LightController.h"
+#include "Seqlock.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr int READERS = 3;
+constexpr uint32_t RUN_MS = 500;
+
+// Same fields as RenderFrame in LightController.cpp
+struct Frame {
+    LightShowParams params;
+    uint8_t colorPhase, brightPhase, xPhase, yPhase;
+    uint8_t brightness;
+    uint8_t maxBrightness;
+    float audio;
+    AudioBands bands;
+    uint16_t morphSeq;
+    uint8_t morph;
+    bool bakedActive;
+    uint32_t bakedFrame;
+    uint32_t atMs;
+};
+
+Frame makeFrame(uint32_t n) {
+    Frame f{};
+    const uint8_t b = static_cast<uint8_t>(n);
+    f.params.RGB1 = CRGB(b, b ^ 0x55, b ^ 0xAA);
+    f.params.RGB2 = CRGB(b ^ 0xFF, b, b);
+    f.params.colorCycleSec = f.params.brightCycleSec = f.params.xCycleSec = f.params.yCycleSec = b;
+    f.params.minBrightness = b;
+    f.params.fadeWidth = f.params.gradientSpeed = f.params.centerX = f.params.centerY = static_cast<float>(n);
+    f.params.radius = f.params.radiusOsc = f.params.xAmp = f.params.yAmp = static_cast<float>(n);
+    f.params.windowWidth = static_cast<int>(n);
+    f.params.program = f.params.baked = b;
+    f.params.noiseSize = f.params.noiseSpeed = static_cast<float>(n);
+    f.params.noiseFps = b;
+    f.colorPhase = f.brightPhase = f.xPhase = f.yPhase = b;
+    f.brightness = f.maxBrightness = b;
+    f.audio = static_cast<float>(n);
+    f.bands = AudioBands{b, b, b, b};
+    f.morphSeq = static_cast<uint16_t>(n);
+    f.morph = b;
+    f.bakedActive = n & 1U;
+    f.bakedFrame = f.atMs = n;
+    return f;
+}
+
+// Whole frame n, field by field (padding is not compared)
+bool isFrame(const Frame &f, uint32_t n) {
+    const Frame e = makeFrame(n);
+    const LightShowParams &p = f.params, &q = e.params;
+    return p.RGB1 == q.RGB1 && p.RGB2 == q.RGB2 && p.colorCycleSec == q.colorCycleSec &&
+           p.brightCycleSec == q.brightCycleSec && p.xCycleSec == q.xCycleSec && p.yCycleSec == q.yCycleSec &&
+           p.minBrightness == q.minBrightness && p.fadeWidth == q.fadeWidth && p.gradientSpeed == q.gradientSpeed &&
+           p.centerX == q.centerX && p.centerY == q.centerY && p.radius == q.radius && p.radiusOsc == q.radiusOsc &&
+           p.xAmp == q.xAmp && p.yAmp == q.yAmp && p.windowWidth == q.windowWidth && p.program == q.program &&
+           p.baked == q.baked && p.noiseSize == q.noiseSize && p.noiseSpeed == q.noiseSpeed &&
+           p.noiseFps == q.noiseFps && f.colorPhase == e.colorPhase && f.brightPhase == e.brightPhase &&
+           f.xPhase == e.xPhase && f.yPhase == e.yPhase && f.brightness == e.brightness &&
+           f.maxBrightness == e.maxBrightness && f.audio == e.audio && f.bands.bass == e.bands.bass &&
+           f.bands.mid == e.bands.mid && f.bands.high == e.bands.high && f.bands.onset == e.bands.onset &&
+           f.morphSeq == e.morphSeq && f.morph == e.morph && f.bakedActive == e.bakedActive &&
+           f.bakedFrame == e.bakedFrame && f.atMs == e.atMs;
+}
+
+struct ReaderStats {
+    uint64_t reads = 0;
+    uint64_t torn = 0;       // Not one whole frame
+    uint64_t mismatched = 0; // Whole frame, but not the one its sequence names
+    uint64_t backwards = 0;  // Older than a frame this reader already saw
+};
+
+} // namespace
+
+int main() {
+    static Seqlock<Frame> slot;
+    std::atomic<bool> stop{false};
+    uint32_t written = 0;
+
+    std::thread writer([&] {
+        while (!stop.load(std::memory_order_relaxed)) slot.write(makeFrame(++written));
+    });
+
+    std::vector<ReaderStats> stats(READERS);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; r++) {
+        readers.emplace_back([&, r] {
+            ReaderStats &s = stats[r];
+            uint32_t lastSeq = 0;
+            Frame f;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const uint32_t seq = slot.read(f);
+                s.reads++;
+                if (seq == 0) continue;  // Nothing written yet
+                const uint32_t n = f.atMs;
+                if (!isFrame(f, n)) s.torn++;
+                else if (n != seq / 2) s.mismatched++;
+                if (seq < lastSeq) s.backwards++;
+                lastSeq = seq;
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(RUN_MS));
+    stop = true;
+    writer.join();
+    for (std::thread &t : readers) t.join();
+
+    ReaderStats total;
+    for (const ReaderStats &s : stats) {
+        total.reads += s.reads;
+        total.torn += s.torn;
+        total.mismatched += s.mismatched;
+        total.backwards += s.backwards;
+    }
+    printf("%u frames of %zu bytes written, %llu reads by %d readers in %u ms (%u hardware threads)\n", written,
+           sizeof(Frame), static_cast<unsigned long long>(total.reads), READERS, RUN_MS,
+           std::thread::hardware_concurrency());
+    printf("torn %llu, sequence mismatch %llu, backwards %llu\n", static_cast<unsigned long long>(total.torn),
+           static_cast<unsigned long long>(total.mismatched), static_cast<unsigned long long>(total.backwards));
+    HostTest::check("writer and readers all ran", written > 0 && total.reads > static_cast<uint64_t>(READERS));
+    HostTest::check("no torn frame", total.torn == 0);
+    HostTest::check("every frame matches its sequence", total.mismatched == 0);
+    HostTest::check("readers never go backwards", total.backwards == 0);
+    return HostTest::result();
+}
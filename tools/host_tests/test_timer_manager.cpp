@@ -0,0 +1,156 @@
+/**
+ * @file test_timer_manager.cpp
+ * @brief Host test: TimerManager handles and restart semantics on a virtual clock
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * A handle must stay stale after its slot was reused 65536 times (a 16-bit
+ * generation would alias it then). restart(cb, ...) on an active timer must
+ * keep its priority and slack, like restart(handle, ...).
+ *
+ * Idle mode: 24 simulated hours of loop() sleeping nextDeadline(loopIdleMaxMs)
+ * between update() calls, with web requests arriving on average every 20 s
+ * and arming a 1 ms timer like RunManager's request* functions. Reports loop
+ * wakeups per hour by cause and the handoff latency with and without wake();
+ * with wake() a request must be served within 1 ms.
+ */
+#include <Arduino.h>
+#include <random>
+#include <string>
+
+#include "TimerManager.h"
+#include "HostTest.h"
+
+namespace {
+
+uint32_t clockMs = 0;
+std::string fired;
+
+uint32_t virtualClock() {
+    return clockMs;
+}
+
+void cb_a() { fired += 'a'; }
+void cb_b() { fired += 'b'; }
+void cb_c() { fired += 'c'; }
+
+uint32_t webArmedMs = 0;
+uint32_t webLatencyMax = 0;
+uint64_t webLatencySum = 0;
+uint32_t webServed = 0;
+
+void cb_tick() {}
+void cb_web() {
+    const uint32_t latency = clockMs - webArmedMs;
+    webLatencySum += latency;
+    webServed++;
+    if (latency > webLatencyMax) webLatencyMax = latency;
+}
+
+void checkGenerationWrap() {
+    TimerManager tm;
+    tm.setClock(virtualClock);
+    const TimerHandle old = tm.create(1000, 1, cb_a);
+    tm.cancel(old);
+    for (uint32_t n = 1; n < 65536; n++) tm.cancel(tm.create(1000, 1, cb_a));
+    const TimerHandle live = tm.create(1000, 1, cb_b);
+    const bool sameSlot = live.slot == old.slot;
+    const bool stale = !tm.isActive(old) && !tm.restart(old, 10, 1);
+    tm.cancel(old);
+    printf("slot %u reused 65536 times: generation %u, old handle %u\n", live.slot,
+           static_cast<unsigned>(live.generation), static_cast<unsigned>(old.generation));
+    HostTest::check("handle stale after 65536 reuses of its slot", sameSlot && stale && tm.isActive(live));
+}
+
+void checkRestartKeepsClass() {
+    TimerManager tm;
+    clockMs = 0;
+    tm.setClock(virtualClock);
+
+    // a is REALTIME and due after b; restarted with the default arguments it must still go first
+    tm.create(5, 0, cb_a, 1.0f, 1, TimerPriority::REALTIME);
+    tm.create(10, 0, cb_b);
+    tm.restart(20, 0, cb_a);
+    clockMs = 20;
+    fired.clear();
+    tm.update();
+    printf("due together after restart(cb): fired \"%s\"\n", fired.c_str());
+    HostTest::check("restart(cb) keeps the priority", fired == "ab");
+
+    // c batches on a 100 ms grid; restarted with the default (no) slack it must stay on it
+    tm.create(1000, 0, cb_c, 1.0f, 1, TimerPriority::BACKGROUND, 100);
+    tm.restart(30, 0, cb_c);
+    tm.cancel(cb_a);
+    tm.cancel(cb_b);
+    const uint32_t wait = tm.nextDeadline();
+    printf("restart(cb, 30 ms) at %u ms with slack 100: due in %u ms\n", clockMs, wait);
+    HostTest::check("restart(cb) keeps the slack", wait == 80);
+}
+
+// Returns the worst handoff latency in ms
+uint32_t simulateIdleLoop(bool useWake) {
+    constexpr uint32_t HOURS = 24;
+    constexpr uint32_t RUN_MS = HOURS * 3600000UL;
+    TimerManager tm;
+    clockMs = 0;
+    tm.setClock(virtualClock);
+    // Loop-side periodic work of a running kwal: frame tick, clock, sensors, shifts, health
+    tm.create(1000, 0, cb_tick, 1.0f, 1);
+    tm.create(5000, 0, cb_tick, 1.0f, 2);
+    tm.create(60000, 0, cb_tick, 1.0f, 3, TimerPriority::BACKGROUND, 15000);
+    tm.create(300000, 0, cb_tick, 1.0f, 4, TimerPriority::BACKGROUND, 75000);
+
+    std::mt19937 rng(4711);
+    std::exponential_distribution<double> gap(1.0 / 20000.0);
+    uint32_t nextRequest = static_cast<uint32_t>(gap(rng)) + 1;
+    webLatencyMax = 0;
+    webLatencySum = 0;
+    webServed = 0;
+    uint32_t byDeadline = 0, byCap = 0, byHandoff = 0, requests = 0, coalesced = 0;
+
+    while (clockMs < RUN_MS) {
+        tm.update();
+        const uint32_t sleepMs = tm.nextDeadline(Globals::loopIdleMaxMs);
+        if (sleepMs == 0) {
+            clockMs++;  // Loop body time
+            continue;
+        }
+        const uint32_t wakeAt = clockMs + sleepMs;
+        const uint32_t wakes = tm.getWakeCount();
+        while (nextRequest < wakeAt && tm.getWakeCount() == wakes) {
+            // Web task arms a 1 ms timer while the loop sleeps
+            clockMs = nextRequest;
+            webArmedMs = clockMs;
+            if (tm.isActive(cb_web)) coalesced++;  // Previous request not served yet: replaced
+            tm.restart(1, 1, cb_web);
+            if (useWake) tm.wake();
+            requests++;
+            nextRequest = clockMs + static_cast<uint32_t>(gap(rng)) + 1;
+        }
+        if (tm.getWakeCount() != wakes) {
+            byHandoff++;
+            continue;
+        }
+        clockMs = wakeAt;
+        if (sleepMs == Globals::loopIdleMaxMs) byCap++;
+        else byDeadline++;
+    }
+    printf("%s wake(): %u requests (%u coalesced), wakeups/h deadline %u, cap %u, handoff %u; "
+           "latency mean %.1f ms, max %u ms\n",
+           useWake ? "with" : "without", requests, coalesced, byDeadline / HOURS, byCap / HOURS, byHandoff / HOURS,
+           webServed ? static_cast<double>(webLatencySum) / webServed : 0.0, webLatencyMax);
+    HostTest::check(useWake ? "with wake(): every request served" : "without wake(): every request served",
+                    webServed + coalesced == requests);
+    return webLatencyMax;
+}
+
+} // namespace
+
+int main() {
+    checkGenerationWrap();
+    checkRestartKeepsClass();
+    const uint32_t withWake = simulateIdleLoop(true);
+    const uint32_t withoutWake = simulateIdleLoop(false);
+    HostTest::check("wake() serves a web request within 1 ms", withWake <= 1 && withoutWake > withWake);
+    return HostTest::result();
+}
@@ -0,0 +1,103 @@
+/**
+ * @file test_timer_threads.cpp
+ * @brief Host test: TimerManager create/restart/cancel from a second std::thread while update() runs
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Like the firmware's web handlers on the async_tcp task: one thread keeps
+ * creating, restarting and cancelling short timers (TOKENS identities of one
+ * callback, by identity and by handle) while the main thread, the loop, steps
+ * a virtual clock 1 ms at a time and calls update(), for at least MIN_MS and
+ * MIN_OPS operations of the other thread. A REALTIME repaint timer
+ * runs on the loop throughout. Checked: the repaint timer fires exactly once
+ * per interval, timers armed from the other thread all fire, none of the
+ * hammered timers stays active without ever firing, and the pool count
+ * returns to the loop's own timers. A lost heap or index entry from an
+ * interleaved update shows up as a missed repaint or a stuck timer.
+ */
+#include <Arduino.h>
+#include <atomic>
+#include <thread>
+
+#include "TimerManager.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint32_t MIN_MS = 20000;      // Virtual time with the other thread hammering, at least
+constexpr uint32_t MIN_OPS = 1000000;   // Operations of the other thread, at least
+constexpr uint32_t REPAINT_MS = 5;
+constexpr uint8_t TOKENS = 24;          // Hammered identities; with repaint and finals well inside MAX_TIMERS
+constexpr uint8_t FINALS = 8;
+
+std::atomic<uint32_t> clockMs{0};
+std::atomic<uint32_t> hammerFires{0};
+std::atomic<uint32_t> finalFires{0};
+uint32_t repaintFires = 0;
+
+uint32_t virtualClock() {
+    return clockMs.load(std::memory_order_relaxed);
+}
+
+void cb_repaint() { repaintFires++; }
+void cb_hammer() { hammerFires++; }
+void cb_final() { finalFires++; }
+
+// Loop task: one update() per virtual millisecond
+void loopFor(uint32_t ms) {
+    for (uint32_t n = 0; n < ms; n++) {
+        clockMs.fetch_add(1, std::memory_order_relaxed);
+        timers.update();
+    }
+}
+
+} // namespace
+
+int main() {
+    timers.setClock(virtualClock);
+    const TimerHandle repaint = timers.create(REPAINT_MS, 0, cb_repaint, 1.0f, 1, TimerPriority::REALTIME);
+    const TimerSlot loopTimers = timers.getActiveCount();
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> ops{0};
+    std::thread web([&] {
+        TimerHandle handles[TOKENS + 1];
+        for (uint32_t n = 0; !stop.load(std::memory_order_relaxed); n++, ops++) {
+            const uint8_t token = 1 + n % TOKENS;
+            switch ((n / TOKENS) % 4) {
+                case 0: handles[token] = timers.create(1 + n % 3, 1, cb_hammer, 1.0f, token); break;
+                case 1: handles[token] = timers.restart(2, 3, cb_hammer, 1.0f, token); break;
+                case 2: timers.restart(handles[token], 1 + n % 4, 2); break;
+                default:
+                    if (n & 1) timers.cancel(cb_hammer, token);
+                    else timers.cancel(handles[token]);
+                    break;
+            }
+        }
+    });
+    uint32_t runMs = 0;
+    for (; runMs < MIN_MS || ops.load(std::memory_order_relaxed) < MIN_OPS; runMs++) loopFor(1);
+    stop = true;
+    web.join();
+
+    // Armed from another thread once more, then left to the loop
+    std::thread arm([] {
+        for (uint8_t token = 1; token <= FINALS; token++) timers.create(2, 1, cb_final, 1.0f, token);
+    });
+    arm.join();
+    loopFor(100);  // Every hammered timer is counted (<= 3 fires of <= 4 ms): all done by now
+
+    bool stuck = false;
+    for (uint8_t token = 1; token <= TOKENS; token++) stuck = stuck || timers.isActive(cb_hammer, token);
+
+    const uint32_t repaints = (runMs + 100) / REPAINT_MS;
+    printf("%u ms, %u ops from the second thread, %u hammered fires, repaint %u of %u, finals %u of %u\n", runMs,
+           ops.load(), hammerFires.load(), repaintFires, repaints, finalFires.load(), FINALS);
+    HostTest::check("second thread ran", ops >= MIN_OPS && hammerFires > 0);
+    HostTest::check("repaint timer fired once per interval", timers.isActive(repaint) && repaintFires == repaints);
+    HostTest::check("timers armed from another thread all fire", finalFires == FINALS);
+    HostTest::check("no hammered timer left active without firing", !stuck);
+    HostTest::check("pool back to the loop's own timers", timers.getActiveCount() == loopTimers &&
+                                                              timers.nextDeadline() <= REPAINT_MS);
+    return HostTest::result();
+}
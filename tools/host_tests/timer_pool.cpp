@@ -0,0 +1,103 @@
+/**
+ * @file timer_pool.cpp
+ * @brief Host benchmark: TimerManager (deadline heap) against the baseline linear scan
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * build.sh compiles this once per pool size (-DMAX_TIMERS=40, 200, 1000) into
+ * test_timer_pool_<N>. Both pools run the same minute of virtual time: three
+ * quarters of the slots busy with periodic timers (20 ms frames to 5 s
+ * housekeeping), update() every millisecond like loop(), an isActive() poll
+ * per millisecond, a restart() every 10 ms and a cancel/create every 100 ms.
+ * Every callback must fire equally often in both; from 200 slots on the heap
+ * must also be faster. The 40-slot run is the firmware's pool and only reported.
+ */
+#include <Arduino.h>
+#include <random>
+#include <utility>
+
+#include "TimerManager.h"
+#include "TimerManagerBaseline.h"
+#include "HostTest.h"
+
+namespace {
+
+constexpr uint16_t CALLBACKS = 16;
+constexpr uint16_t ACTIVE = MAX_TIMERS * 3 / 4;
+constexpr uint32_t RUN_MS = 60000;
+constexpr uint32_t INTERVALS[] = {20, 50, 100, 250, 1000, 5000};
+
+uint32_t clockMs = 0;
+uint32_t *fires = nullptr;  // Per callback, of the pool being run
+
+uint32_t virtualClock() {
+    return clockMs;
+}
+
+template <int K>
+void cb_fire() {
+    fires[K]++;
+}
+
+template <int... K>
+constexpr TimerCallback pick(int k, std::integer_sequence<int, K...>) {
+    constexpr TimerCallback all[] = {cb_fire<K>...};
+    return all[k];
+}
+
+TimerCallback callback(uint16_t k) {
+    return pick(k, std::make_integer_sequence<int, CALLBACKS>{});
+}
+
+// Timer n: callback n % CALLBACKS, token n / CALLBACKS + 1
+template <typename Pool>
+double run(Pool &pool, uint32_t *counts) {
+    std::mt19937 rng(4711);
+    auto interval = [&] { return INTERVALS[rng() % (sizeof(INTERVALS) / sizeof(INTERVALS[0]))]; };
+    fires = counts;
+    clockMs = 0;
+    for (uint16_t n = 0; n < ACTIVE; n++) {
+        pool.create(interval(), 0, callback(n % CALLBACKS), 1.0f, static_cast<uint8_t>(n / CALLBACKS + 1));
+    }
+    volatile uint32_t polled = 0;
+    const HostTest::Stopwatch watch;
+    for (clockMs = 1; clockMs <= RUN_MS; clockMs++) {
+        pool.update();
+        const uint16_t n = rng() % ACTIVE;
+        const TimerCallback cb = callback(n % CALLBACKS);
+        const uint8_t token = static_cast<uint8_t>(n / CALLBACKS + 1);
+        polled = polled + pool.isActive(cb, token);
+        if (clockMs % 10 == 0) pool.restart(interval(), 0, cb, 1.0f, token);
+        if (clockMs % 100 == 0) {
+            pool.cancel(cb, token);
+            pool.create(interval(), 0, cb, 1.0f, token);
+        }
+    }
+    return watch.us();
+}
+
+} // namespace
+
+int main() {
+    static TimerManager heapPool;
+    static TimerManagerBaseline linearPool(virtualClock);
+    heapPool.setClock(virtualClock);
+
+    uint32_t heapFires[CALLBACKS] = {}, linearFires[CALLBACKS] = {};
+    const double linearUs = run(linearPool, linearFires);
+    const double heapUs = run(heapPool, heapFires);
+
+    uint64_t total = 0;
+    bool same = heapPool.getActiveCount() == linearPool.getActiveCount();
+    for (uint16_t k = 0; k < CALLBACKS; k++) {
+        same = same && heapFires[k] == linearFires[k];
+        total += heapFires[k];
+    }
+    printf("%u slots, %u timers, %u ms: %llu fires\n", MAX_TIMERS, ACTIVE, RUN_MS,
+           static_cast<unsigned long long>(total));
+    printf("baseline %.3f us per loop, heap %.3f us per loop: %.1fx\n", linearUs / RUN_MS, heapUs / RUN_MS,
+           linearUs / heapUs);
+    HostTest::check("same fires per callback as the baseline", same && total > 0);
+    if (MAX_TIMERS >= 200) HostTest::check("heap faster than the baseline", heapUs < linearUs);
+    return HostTest::result();
+}
@@ -0,0 +1,272 @@
+"""Compile a light program (.lps) into LightVM bytecode (.lpb).
+
+A program sets `index` (gradient position in turns, wraps) and `bright`
+(0..1 of minBrightness..max) for every LED; see lib/LightController/LightVM.h.
+
+    # comment
+    ring = 1 - abs(dist - radius) / fade_width
+    index = color_phase + dist / 80
+    bright = clamp(ring) * (0.6 + 0.4 * audio)
+
+Inputs: x y dist led color_phase bright_phase x_phase y_phase audio radius fade_width
+        bass mid high onset (audio spectrum, 0..1; onset jumps to 1 on a beat and decays)
+Functions: sin cos (turns) abs fract floor sqrt clamp (0..1), min max, mix(a, b, t)
+Operators: + - * / % < > and `c ? a : b` (c > 0). Other names are variables (max 8).
+
+Usage:
+    python tools/light_compile.py sdroot/light_programs/1.lps
+    python tools/light_compile.py prog.lps -o sdroot/light_programs/3.lpb --list
+"""
+import argparse, os, re, struct, sys
+
+NUM_LEDS = 160
+DEFAULT_BUDGET = 8000     # Globals::lightProgramBudget
+CODE_MAX = 255
+STACK_MAX = 16
+VAR_COUNT = 8
+
+INPUTS = ["x", "y", "dist", "led", "color_phase", "bright_phase", "x_phase", "y_phase",
+          "audio", "radius", "fade_width", "bass", "mid", "high", "onset"]
+
+# name: (opcode, pops, pushes)
+OPS = {
+    "PUSH": (0x01, 0, 1), "IN": (0x02, 0, 1), "LOAD": (0x03, 0, 1), "STORE": (0x04, 1, 0),
+    "ADD": (0x10, 2, 1), "SUB": (0x11, 2, 1), "MUL": (0x12, 2, 1), "DIV": (0x13, 2, 1),
+    "MOD": (0x14, 2, 1), "MIN": (0x15, 2, 1), "MAX": (0x16, 2, 1), "LT": (0x17, 2, 1),
+    "GT": (0x18, 2, 1),
+    "NEG": (0x20, 1, 1), "ABS": (0x21, 1, 1), "SIN": (0x22, 1, 1), "COS": (0x23, 1, 1),
+    "FRACT": (0x24, 1, 1), "FLOOR": (0x25, 1, 1), "SQRT": (0x26, 1, 1), "CLAMP": (0x27, 1, 1),
+    "SELECT": (0x30, 3, 1), "MIX": (0x31, 3, 1),
+    "INDEX": (0x40, 1, 0), "BRIGHT": (0x41, 1, 0),
+}
+FUNCTIONS = {"sin": "SIN", "cos": "COS", "abs": "ABS", "fract": "FRACT", "floor": "FLOOR",
+             "sqrt": "SQRT", "clamp": "CLAMP", "min": "MIN", "max": "MAX", "mix": "MIX"}
+BINARY = {"+": "ADD", "-": "SUB", "*": "MUL", "/": "DIV", "%": "MOD", "<": "LT", ">": "GT"}
+
+TOKEN = re.compile(r"\s*(?:(\d+\.?\d*|\.\d+)|([A-Za-z_]\w*)|(.))")
+
+
+class CompileError(Exception):
+    pass
+
+
+def tokenize(text):
+    tokens = []
+    for number, name, op in TOKEN.findall(text):
+        if number:
+            tokens.append(("num", float(number)))
+        elif name:
+            tokens.append(("name", name))
+        elif op.strip():
+            tokens.append(("op", op))
+    tokens.append(("end", None))
+    return tokens
+
+
+# Expression tree nodes: ("num", v) ("in", i) ("var", i) ("call", OP, [args])
+class Parser:
+    def __init__(self, tokens, variables):
+        self.tokens = tokens
+        self.pos = 0
+        self.variables = variables
+
+    def peek(self):
+        return self.tokens[self.pos]
+
+    def take(self, kind=None, value=None):
+        tok = self.tokens[self.pos]
+        if (kind and tok[0] != kind) or (value is not None and tok[1] != value):
+            raise CompileError("expected %s, got %r" % (value or kind, tok[1]))
+        self.pos += 1
+        return tok
+
+    def expression(self):
+        cond = self.comparison()
+        if self.peek() == ("op", "?"):
+            self.take()
+            a = self.expression()
+            self.take("op", ":")
+            b = self.expression()
+            return ("call", "SELECT", [cond, a, b])
+        return cond
+
+    def binary(self, ops, operand):
+        node = operand()
+        while self.peek()[0] == "op" and self.peek()[1] in ops:
+            op = self.take()[1]
+            node = ("call", BINARY[op], [node, operand()])
+        return node
+
+    def comparison(self):
+        return self.binary("<>", self.additive)
+
+    def additive(self):
+        return self.binary("+-", self.term)
+
+    def term(self):
+        return self.binary("*/%", self.unary)
+
+    def unary(self):
+        if self.peek() == ("op", "-"):
+            self.take()
+            return ("call", "NEG", [self.unary()])
+        return self.primary()
+
+    def primary(self):
+        kind, value = self.take()
+        if kind == "num":
+            return ("num", value)
+        if kind == "op" and value == "(":
+            node = self.expression()
+            self.take("op", ")")
+            return node
+        if kind != "name":
+            raise CompileError("unexpected %r" % value)
+        if self.peek() == ("op", "("):
+            if value not in FUNCTIONS:
+                raise CompileError("unknown function %s" % value)
+            self.take()
+            args = [self.expression()]
+            while self.peek() == ("op", ","):
+                self.take()
+                args.append(self.expression())
+            self.take("op", ")")
+            op = FUNCTIONS[value]
+            if len(args) != OPS[op][1]:
+                raise CompileError("%s takes %d argument(s)" % (value, OPS[op][1]))
+            return ("call", op, args)
+        if value in INPUTS:
+            return ("in", INPUTS.index(value))
+        if value in self.variables:
+            return ("var", self.variables[value])
+        raise CompileError("unknown name %s" % value)
+
+
+def fold(node):
+    """Evaluate constant subexpressions at compile time (saves instructions per LED)."""
+    if node[0] != "call":
+        return node
+    args = [fold(a) for a in node[2]]
+    if not all(a[0] == "num" for a in args) or node[1] in ("SIN", "COS"):
+        return ("call", node[1], args)
+    v = [a[1] for a in args]
+    f = {
+        "ADD": lambda: v[0] + v[1], "SUB": lambda: v[0] - v[1], "MUL": lambda: v[0] * v[1],
+        "DIV": lambda: v[0] / v[1] if v[1] else 0.0, "NEG": lambda: -v[0],
+        "MIN": lambda: min(v), "MAX": lambda: max(v), "ABS": lambda: abs(v[0]),
+    }.get(node[1])
+    return ("num", struct.unpack("<f", struct.pack("<f", f()))[0]) if f else ("call", node[1], args)
+
+
+def emit(node, code):
+    kind = node[0]
+    if kind == "num":
+        code.append(("PUSH", node[1]))
+    elif kind == "in":
+        code.append(("IN", node[1]))
+    elif kind == "var":
+        code.append(("LOAD", node[1]))
+    else:
+        for arg in node[2]:
+            emit(arg, code)
+        code.append((node[1], None))
+
+
+def compile_source(text):
+    variables = {}
+    code = []
+    for lineno, line in enumerate(text.splitlines(), 1):
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        try:
+            m = re.match(r"([A-Za-z_]\w*)\s*=(.*)$", line)
+            if not m:
+                raise CompileError("expected `name = expression`")
+            target, expr = m.group(1), m.group(2)
+            parser = Parser(tokenize(expr), variables)
+            node = fold(parser.expression())
+            parser.take("end")
+            emit(node, code)
+            if target == "index":
+                code.append(("INDEX", None))
+            elif target == "bright":
+                code.append(("BRIGHT", None))
+            elif target in INPUTS or target in FUNCTIONS:
+                raise CompileError("cannot assign to %s" % target)
+            else:
+                if target not in variables:
+                    if len(variables) == VAR_COUNT:
+                        raise CompileError("more than %d variables" % VAR_COUNT)
+                    variables[target] = len(variables)
+                code.append(("STORE", variables[target]))
+        except CompileError as e:
+            raise CompileError("line %d: %s" % (lineno, e))
+    return code
+
+
+def assemble(code):
+    out = bytearray()
+    depth = peak = 0
+    for name, operand in code:
+        opcode, pops, pushes = OPS[name]
+        depth += pushes - pops
+        peak = max(peak, depth)
+        out.append(opcode)
+        if name == "PUSH":
+            out += struct.pack("<f", operand)
+        elif operand is not None:
+            out.append(operand)
+    if peak > STACK_MAX:
+        raise CompileError("expression needs %d stack entries (max %d)" % (peak, STACK_MAX))
+    if len(out) > CODE_MAX:
+        raise CompileError("%d bytes of code (max %d)" % (len(out), CODE_MAX))
+    return b"LVM1" + bytes([len(out)]) + bytes(out)
+
+
+def listing(code):
+    names = {i: n for i, n in enumerate(INPUTS)}
+    for name, operand in code:
+        if name == "IN":
+            print("  %-6s %s" % (name, names[operand]))
+        elif operand is not None:
+            print("  %-6s %g" % (name, operand))
+        else:
+            print("  %s" % name)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Compile a light program for LightVM")
+    ap.add_argument("source", help=".lps source file")
+    ap.add_argument("-o", "--output", help="output .lpb (default: source with .lpb extension)")
+    ap.add_argument("--budget", type=int, default=DEFAULT_BUDGET,
+                    help="instructions per frame (Globals::lightProgramBudget, default %d)" % DEFAULT_BUDGET)
+    ap.add_argument("--list", action="store_true", help="print the instructions")
+    args = ap.parse_args()
+
+    with open(args.source, encoding="utf-8") as f:
+        text = f.read()
+    try:
+        code = compile_source(text)
+        if not any(name in ("INDEX", "BRIGHT") for name, _ in code):
+            raise CompileError("program sets neither index nor bright")
+        blob = assemble(code)
+    except CompileError as e:
+        sys.exit("%s: %s" % (args.source, e))
+
+    per_frame = len(code) * NUM_LEDS
+    if args.list:
+        listing(code)
+    print("%d instructions per LED, %d per frame (budget %d), %d bytes"
+          % (len(code), per_frame, args.budget, len(blob)))
+    if per_frame > args.budget:
+        sys.exit("over budget: the firmware would refuse this program")
+
+    output = args.output or os.path.splitext(args.source)[0] + ".lpb"
+    with open(output, "wb") as f:
+        f.write(blob)
+    print("wrote %s" % output)
+
+
+if __name__ == "__main__":
+    main()
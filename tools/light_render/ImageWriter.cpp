@@ -0,0 +1,239 @@
+/**
+ * @file ImageWriter.cpp
+ * @brief Dependency-free PNG and animated GIF output (light_render tool)
+ * @version 261016O
+ * @date 2026-10-16
+ */
+#include "ImageWriter.h"
+
+#include <algorithm>
+#include <map>
+
+namespace {
+
+// ===== PNG =====
+uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0) {
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+void putBE32(std::vector<uint8_t> &out, uint32_t v) {
+    out.push_back(v >> 24);
+    out.push_back((v >> 16) & 0xFF);
+    out.push_back((v >> 8) & 0xFF);
+    out.push_back(v & 0xFF);
+}
+
+void writeChunk(FILE *fp, const char *type, const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> chunk;
+    putBE32(chunk, static_cast<uint32_t>(data.size()));
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    putBE32(chunk, crc32(chunk.data() + 4, chunk.size() - 4));
+    fwrite(chunk.data(), 1, chunk.size(), fp);
+}
+
+} // namespace
+
+bool writePng(const char *path, int width, int height, const uint8_t *rgb) {
+    FILE *fp = fopen(path, "wb");
+    if (!fp) return false;
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, sizeof(signature), fp);
+
+    std::vector<uint8_t> ihdr;
+    putBE32(ihdr, static_cast<uint32_t>(width));
+    putBE32(ihdr, static_cast<uint32_t>(height));
+    ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0});  // 8-bit RGB, deflate, no filter, no interlace
+    writeChunk(fp, "IHDR", ihdr);
+
+    // Scanlines with filter type 0
+    std::vector<uint8_t> raw;
+    const size_t stride = static_cast<size_t>(width) * 3;
+    raw.reserve((stride + 1) * height);
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgb + y * stride, rgb + (y + 1) * stride);
+    }
+
+    // zlib stream of stored deflate blocks
+    std::vector<uint8_t> idat = {0x78, 0x01};
+    uint32_t a = 1, b = 0;
+    size_t pos = 0;
+    bool last = false;
+    while (!last) {
+        const uint16_t len = static_cast<uint16_t>(std::min<size_t>(raw.size() - pos, 65535));
+        last = pos + len >= raw.size();
+        idat.push_back(last ? 1 : 0);
+        idat.push_back(len & 0xFF);
+        idat.push_back(len >> 8);
+        idat.push_back(~len & 0xFF);
+        idat.push_back((~len >> 8) & 0xFF);
+        for (size_t i = pos; i < pos + len; i++) {
+            idat.push_back(raw[i]);
+            a = (a + raw[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        pos += len;
+    }
+    putBE32(idat, (b << 16) | a);
+    writeChunk(fp, "IDAT", idat);
+    writeChunk(fp, "IEND", {});
+
+    return fclose(fp) == 0;
+}
+
+// ===== GIF =====
+bool GifWriter::open(const char *path, int width, int height) {
+    close();
+    fp_ = fopen(path, "wb");
+    if (!fp_) return false;
+    width_ = width;
+    height_ = height;
+
+    fputs("GIF89a", fp_);
+    put16(static_cast<uint16_t>(width));
+    put16(static_cast<uint16_t>(height));
+    put(0x00);  // No global color table
+    put(0x00);  // Background color index
+    put(0x00);  // Pixel aspect ratio
+
+    // NETSCAPE2.0: loop forever
+    put(0x21); put(0xFF); put(11);
+    fputs("NETSCAPE2.0", fp_);
+    put(3); put(1); put16(0); put(0);
+    return true;
+}
+
+bool GifWriter::addFrame(const uint8_t *rgb, uint16_t delayCs) {
+    if (!fp_) return false;
+    const size_t pixels = static_cast<size_t>(width_) * height_;
+
+    // Local palette of the frame's own colors; 3-3-2 quantization if there are more than 256
+    std::map<uint32_t, uint8_t> lookup;
+    std::vector<uint32_t> palette;
+    std::vector<uint8_t> indices(pixels);
+    bool quantize = false;
+    for (size_t i = 0; i < pixels && !quantize; i++) {
+        const uint32_t c = (rgb[3 * i] << 16) | (rgb[3 * i + 1] << 8) | rgb[3 * i + 2];
+        auto it = lookup.find(c);
+        if (it == lookup.end()) {
+            if (palette.size() == 256) {
+                quantize = true;
+                break;
+            }
+            it = lookup.emplace(c, static_cast<uint8_t>(palette.size())).first;
+            palette.push_back(c);
+        }
+        indices[i] = it->second;
+    }
+    if (quantize) {
+        palette.clear();
+        for (uint32_t i = 0; i < 256; i++) {
+            palette.push_back((((i >> 5) * 255 / 7) << 16) | ((((i >> 2) & 7) * 255 / 7) << 8) | ((i & 3) * 255 / 3));
+        }
+        for (size_t i = 0; i < pixels; i++) {
+            indices[i] = static_cast<uint8_t>((rgb[3 * i] & 0xE0) | ((rgb[3 * i + 1] >> 3) & 0x1C) | (rgb[3 * i + 2] >> 6));
+        }
+    }
+    palette.resize(256, 0);
+
+    // Graphic control extension: frame delay, no transparency
+    put(0x21); put(0xF9); put(4);
+    put(0x04);  // Dispose: leave in place
+    put16(delayCs);
+    put(0); put(0);
+
+    // Image descriptor with a 256-entry local color table
+    put(0x2C);
+    put16(0); put16(0);
+    put16(static_cast<uint16_t>(width_));
+    put16(static_cast<uint16_t>(height_));
+    put(0x87);
+    for (uint32_t c : palette) {
+        put(c >> 16); put((c >> 8) & 0xFF); put(c & 0xFF);
+    }
+
+    writeLzw(indices);
+    return true;
+}
+
+bool GifWriter::close() {
+    if (!fp_) return true;
+    put(0x3B);
+    const bool ok = fclose(fp_) == 0;
+    fp_ = nullptr;
+    return ok;
+}
+
+void GifWriter::writeLzw(const std::vector<uint8_t> &indices) {
+    const int minCodeSize = 8;
+    const int clearCode = 1 << minCodeSize;
+    put(minCodeSize);
+
+    std::vector<uint8_t> block;
+    uint32_t bitBuf = 0;
+    int bitCount = 0;
+    auto flushBlock = [&]() {
+        if (block.empty()) return;
+        put(static_cast<uint8_t>(block.size()));
+        fwrite(block.data(), 1, block.size(), fp_);
+        block.clear();
+    };
+    auto writeCode = [&](int code, int size) {
+        bitBuf |= static_cast<uint32_t>(code) << bitCount;
+        bitCount += size;
+        while (bitCount >= 8) {
+            block.push_back(bitBuf & 0xFF);
+            bitBuf >>= 8;
+            bitCount -= 8;
+            if (block.size() == 255) flushBlock();
+        }
+    };
+
+    // Dictionary as a (prefix code, next index) -> code table
+    std::vector<int16_t> next(4096 * 256, -1);
+    int codeSize = minCodeSize + 1;
+    int maxCode = clearCode + 1;
+    int cur = -1;
+
+    writeCode(clearCode, codeSize);
+    for (uint8_t value : indices) {
+        if (cur < 0) {
+            cur = value;
+            continue;
+        }
+        const int16_t known = next[cur * 256 + value];
+        if (known >= 0) {
+            cur = known;
+            continue;
+        }
+        writeCode(cur, codeSize);
+        next[cur * 256 + value] = static_cast<int16_t>(++maxCode);
+        if (maxCode >= (1 << codeSize)) codeSize++;
+        if (maxCode == 4095) {
+            writeCode(clearCode, codeSize);
+            std::fill(next.begin(), next.end(), -1);
+            codeSize = minCodeSize + 1;
+            maxCode = clearCode + 1;
+        }
+        cur = value;
+    }
+    writeCode(cur, codeSize);
+    // Clear before the end code, so the decoder's code size is known again
+    writeCode(clearCode, codeSize);
+    writeCode(clearCode + 1, minCodeSize + 1);
+    if (bitCount > 0) block.push_back(bitBuf & 0xFF);
+    flushBlock();
+    put(0);  // Block terminator
+}
@@ -0,0 +1,35 @@
+/**
+ * @file ImageWriter.h
+ * @brief Dependency-free PNG and animated GIF output (light_render tool)
+ * @version 261016O
+ * @date 2026-10-16
+ *
+ * Images are packed 8-bit RGB, row by row. PNG uses stored (uncompressed)
+ * deflate blocks; GIF frames get a local palette of their own colors, so
+ * LED renders with up to 256 distinct colors per frame are exact.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+bool writePng(const char *path, int width, int height, const uint8_t *rgb);
+
+class GifWriter {
+public:
+    ~GifWriter() { close(); }
+
+    bool open(const char *path, int width, int height);
+    bool addFrame(const uint8_t *rgb, uint16_t delayCs);  ///< delay in 1/100 s
+    bool close();
+
+private:
+    void put(uint8_t b) { fputc(b, fp_); }
+    void put16(uint16_t v) { put(v & 0xFF); put(v >> 8); }
+    void writeLzw(const std::vector<uint8_t> &indices);
+
+    FILE *fp_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+};
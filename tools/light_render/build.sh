@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+# Build the offline light renderer (host g++ / clang++, C++17).
+# Needs ArduinoJson 6 sources: run `pio run` once so PlatformIO fetches them,
+# or point ARDUINOJSON_DIR at its src/ directory.
+# Extra arguments go to the compiler, e.g. ./build.sh -DLIGHT_FIXED_POINT=1
+set -e
+cd "$(dirname "$0")/../.."
+
+CXX="${CXX:-g++}"
+ARDUINOJSON_DIR="${ARDUINOJSON_DIR:-.pio/libdeps/esp32/ArduinoJson/src}"
+OUT=tools/light_render/build
+mkdir -p "$OUT"
+
+"$CXX" -std=gnu++17 -O2 \
+    -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -DARDUINOJSON_ENABLE_ARDUINO_STREAM=0 \
+    -DARDUINOJSON_ENABLE_ARDUINO_PRINT=0 -DARDUINOJSON_ENABLE_PROGMEM=0 \
+    -Itools/light_render/host \
+    -Ilib/Globals -Ilib/LightController -Ilib/TimerManager -Ilib/RunManager -Ilib/RunManager/Light \
+    -Ilib/RunManager/Heartbeat -Ilib/ContextController \
+    -Ilib/AudioManager -Ilib/SensorController -Ilib/SDController \
+    -I"$ARDUINOJSON_DIR" \
+    "$@" \
+    tools/light_render/light_render.cpp tools/light_render/ImageWriter.cpp tools/light_render/host/HostStubs.cpp tools/light_render/host/HostFirmware.cpp \
+    lib/LightController/LightController.cpp lib/LightController/LightCompositor.cpp lib/LightController/LEDMap.cpp lib/LightController/LightVM.cpp lib/LightController/LightPower.cpp lib/LightController/BakedShow.cpp lib/LightController/LightZones.cpp lib/LightController/LightNoise.cpp \
+    lib/AudioManager/AudioSpectrum.cpp \
+    lib/TimerManager/TimerManager.cpp \
+    lib/Globals/LogBuffer.cpp lib/Globals/CsvUtils.cpp lib/Globals/SdPathUtils.cpp \
+    lib/RunManager/Light/PatternCatalog.cpp lib/RunManager/Light/ColorsCatalog.cpp lib/RunManager/Light/ZoneTable.cpp \
+    -o "$OUT/light_render"
+
+echo "built $OUT/light_render"
@@ -0,0 +1,82 @@
+/**
+ * @file Arduino.h
+ * @brief Host stand-in for the Arduino/ESP32 core (light_render tool)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Just enough of Arduino, FreeRTOS and Serial for the light rendering sources
+ * to compile unmodified on Linux. The tool is single-threaded: task calls are
+ * no-ops, and LIGHT_RENDER_TASK is not supported. Critical sections take a
+ * real (recursive) mutex, so host tests can drive shared state such as
+ * TimerManager from std::thread.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include "WString.h"
+
+using std::max;
+using std::min;
+
+#define F(s) (s)
+#define PSTR(s) (s)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// ===== Time (real clock; TimerManager runs on the tool's virtual clock) =====
+uint32_t millis();
+uint32_t micros();
+inline void delay(uint32_t) {}
+inline void yield() {}
+
+// ===== Random =====
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// ===== Serial =====
+class HostSerial {
+public:
+    void print(const char *s) { fputs(s, stderr); }
+    void print(const String &s) { fputs(s.c_str(), stderr); }
+    void println(const char *s = "") { fprintf(stderr, "%s\n", s); }
+    void println(const String &s) { println(s.c_str()); }
+    void write(char c) { fputc(c, stderr); }
+    int printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, fmt);
+        const int n = vfprintf(stderr, fmt, args);
+        va_end(args);
+        return n;
+    }
+};
+extern HostSerial Serial;
+
+// ===== FreeRTOS (single task on host) =====
+typedef void *TaskHandle_t;
+typedef int BaseType_t;
+typedef void (*TaskFunction_t)(void *);
+struct portMUX_TYPE {
+    std::recursive_mutex lock;
+};
+#define pdFALSE 0
+#define pdTRUE 1
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define pdMS_TO_TICKS(ms) (ms)
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(mux) ((mux)->lock.lock())
+#define portEXIT_CRITICAL(mux) ((mux)->lock.unlock())
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return nullptr; }
+inline uint32_t ulTaskNotifyTake(BaseType_t, uint32_t) { return 0; }
+inline void xTaskNotifyGive(TaskHandle_t) {}
+inline void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t *) {}
+inline BaseType_t xPortGetCoreID() { return 1; }
@@ -0,0 +1,71 @@
+/**
+ * @file FS.h
+ * @brief Host stand-in for the ESP32 file API (light_render tool)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * fs::File over a stdio FILE*. Paths are resolved by SD (see SD.h) against
+ * the directory given with --sd.
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class File {
+public:
+    File() = default;
+    File(FILE *fp, const String &name, bool isDir = false) : fp_(fp), name_(name), dir_(isDir) {}
+
+    explicit operator bool() const { return fp_ != nullptr || dir_; }
+    bool isDirectory() const { return dir_; }
+    const char *name() const { return name_.c_str(); }
+    File openNextFile() { return File(); }  // Directory listing is not needed by the tool
+
+    size_t size() const;
+    int available();
+    int read();
+    size_t read(uint8_t *buf, size_t len) { return fp_ ? fread(buf, 1, len, fp_) : 0; }
+    String readStringUntil(char terminator);
+    size_t position() const { return fp_ ? static_cast<size_t>(ftell(fp_)) : 0; }
+    bool seek(uint32_t pos) { return fp_ && fseek(fp_, static_cast<long>(pos), SEEK_SET) == 0; }
+    size_t write(const uint8_t *buf, size_t len) { return fp_ ? fwrite(buf, 1, len, fp_) : 0; }
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t print(const char *s) { return write(reinterpret_cast<const uint8_t *>(s), strlen(s)); }
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+    size_t print(double v, int digits) { return print(String(v, static_cast<unsigned int>(digits))); }
+    template <typename T>
+    size_t print(T v) { return print(String(v)); }
+    size_t println(const char *s = "") { return print(s) + print('\n'); }
+    size_t println(const String &s) { return println(s.c_str()); }
+    template <typename T>
+    size_t println(T v) { return print(v) + print('\n'); }
+    void flush() { if (fp_) fflush(fp_); }
+    void close();
+
+private:
+    FILE *fp_ = nullptr;
+    String name_;
+    bool dir_ = false;
+};
+
+/// Base of SDFS, as on the ESP32 (modules keep an fs::FS&)
+class FS {
+public:
+    virtual ~FS() = default;
+    virtual File open(const char *path, const char *mode = FILE_READ) = 0;
+    virtual bool exists(const char *path) const = 0;
+    virtual bool remove(const char *path) = 0;
+    virtual bool mkdir(const char *path) = 0;
+    virtual bool rmdir(const char *path) = 0;
+};
+
+} // namespace fs
+
+using fs::File;
@@ -0,0 +1,235 @@
+/**
+ * @file FastLED.h
+ * @brief Host stand-in for the FastLED subset used by the light sources (light_render tool)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * The 8/16-bit math (scale8, scale16, nscale8_video, lerp8by8, sin16, ...)
+ * and inoise16 follow FastLED's portable C implementations, so rendered
+ * frames match the device bit for bit. FastLED.show() hands leds[] to a capture hook instead
+ * of a strip. HSV conversion is a plain spectrum approximation; the tool only
+ * links it, it does not render with it. FastLED's power model is vendored
+ * with the host tests (tools/host_tests/vendor/FastLED).
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+typedef uint8_t fract8;
+typedef uint16_t fract16;
+
+#define DISABLE_DITHER 0x00
+#define BINARY_DITHER 0x01
+
+// ===== lib8tion =====
+inline uint8_t scale8(uint8_t i, fract8 scale) {
+    return static_cast<uint8_t>((static_cast<uint16_t>(i) * (1 + static_cast<uint16_t>(scale))) >> 8);
+}
+
+inline uint8_t scale8_video(uint8_t i, fract8 scale) {
+    return static_cast<uint8_t>(((static_cast<int>(i) * static_cast<int>(scale)) >> 8) + ((i && scale) ? 1 : 0));
+}
+
+inline uint16_t scale16(uint16_t i, fract16 scale) {
+    return static_cast<uint16_t>((static_cast<uint32_t>(i) * (1 + static_cast<uint32_t>(scale))) >> 16);
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    const unsigned int t = i + j;
+    return t > 255 ? 255 : static_cast<uint8_t>(t);
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    const int t = i - j;
+    return t < 0 ? 0 : static_cast<uint8_t>(t);
+}
+
+inline uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+    if (b > a) return static_cast<uint8_t>(a + scale8(b - a, frac));
+    return static_cast<uint8_t>(a - scale8(a - b, frac));
+}
+
+inline int16_t sin16(uint16_t theta) {
+    static const uint16_t base[] = {0, 6393, 12539, 18204, 23170, 27245, 30273, 32137};
+    static const uint8_t slope[] = {49, 48, 44, 38, 31, 23, 14, 4};
+
+    uint16_t offset = (theta & 0x3FFF) >> 3;  // 0..2047
+    if (theta & 0x4000) offset = 2047 - offset;
+
+    const uint8_t section = offset / 256;  // 0..7
+    const uint8_t secoffset8 = static_cast<uint8_t>(offset) / 2;
+    int16_t y = static_cast<int16_t>(slope[section] * secoffset8 + base[section]);
+    if (theta & 0x8000) y = -y;
+    return y;
+}
+
+inline int16_t cos16(uint16_t theta) {
+    return sin16(static_cast<uint16_t>(theta + 16384));
+}
+
+inline uint16_t ease16InOutQuad(uint16_t i) {
+    uint16_t j = i;
+    if (j & 0x8000) j = 65535 - j;
+    const uint16_t jj = scale16(j, j);
+    uint16_t jj2 = static_cast<uint16_t>(jj << 1);
+    if (i & 0x8000) jj2 = 65535 - jj2;
+    return jj2;
+}
+
+inline int16_t lerp15by16(int16_t a, int16_t b, fract16 frac) {
+    if (b > a) return static_cast<int16_t>(a + scale16(static_cast<uint16_t>(b - a), frac));
+    return static_cast<int16_t>(a - scale16(static_cast<uint16_t>(a - b), frac));
+}
+
+inline int16_t avg15(int16_t i, int16_t j) {
+    return static_cast<int16_t>((i >> 1) + (j >> 1) + (i & 0x1));
+}
+
+// ===== noise =====
+// Perlin's permutation, p[256] = p[0] so P(X + 1) needs no wrap
+namespace fastled_noise {
+static const uint8_t p[257] = {
+    151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225, 140, 36, 103, 30, 69, 142,
+    8, 99, 37, 240, 21, 10, 23, 190, 6, 148, 247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203,
+    117, 35, 11, 32, 57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175, 74, 165,
+    71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122, 60, 211, 133, 230, 220, 105, 92, 41,
+    55, 46, 245, 40, 244, 102, 143, 54, 65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89,
+    18, 169, 200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64, 52, 217, 226, 250,
+    124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212, 207, 206, 59, 227, 47, 16, 58, 17, 182, 189,
+    28, 42, 223, 183, 170, 213, 119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+    129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104, 218, 246, 97, 228, 251, 34,
+    242, 193, 238, 210, 144, 12, 191, 179, 162, 241, 81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31,
+    181, 199, 106, 157, 184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93, 222, 114,
+    67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180, 151};
+
+inline int16_t grad16(uint8_t hash, int16_t x, int16_t y, int16_t z) {
+    hash = hash & 15;
+    int16_t u = hash < 8 ? x : y;
+    int16_t v = hash < 4 ? y : hash == 12 || hash == 14 ? x : z;
+    if (hash & 1) u = -u;
+    if (hash & 2) v = -v;
+    return avg15(u, v);
+}
+} // namespace fastled_noise
+
+// 3D Perlin noise, coordinates in 16.16 fixed point (one lattice cell = 65536)
+inline int16_t inoise16_raw(uint32_t x, uint32_t y, uint32_t z) {
+    using fastled_noise::grad16;
+    const uint8_t *P = fastled_noise::p;
+    const uint8_t X = (x >> 16) & 0xFF, Y = (y >> 16) & 0xFF, Z = (z >> 16) & 0xFF;
+
+    const uint8_t A = P[X] + Y, AA = P[A] + Z, AB = P[static_cast<uint8_t>(A + 1)] + Z;
+    const uint8_t B = P[X + 1] + Y, BA = P[B] + Z, BB = P[static_cast<uint8_t>(B + 1)] + Z;
+
+    uint16_t u = x & 0xFFFF, v = y & 0xFFFF, w = z & 0xFFFF;
+    const int16_t xx = (u >> 1) & 0x7FFF, yy = (v >> 1) & 0x7FFF, zz = (w >> 1) & 0x7FFF;
+    const uint16_t N = 0x8000;
+    u = ease16InOutQuad(u);
+    v = ease16InOutQuad(v);
+    w = ease16InOutQuad(w);
+
+    const int16_t X1 = lerp15by16(grad16(P[AA], xx, yy, zz), grad16(P[BA], xx - N, yy, zz), u);
+    const int16_t X2 = lerp15by16(grad16(P[AB], xx, yy - N, zz), grad16(P[BB], xx - N, yy - N, zz), u);
+    const int16_t X3 = lerp15by16(grad16(P[static_cast<uint8_t>(AA + 1)], xx, yy, zz - N),
+                                  grad16(P[static_cast<uint8_t>(BA + 1)], xx - N, yy, zz - N), u);
+    const int16_t X4 = lerp15by16(grad16(P[static_cast<uint8_t>(AB + 1)], xx, yy - N, zz - N),
+                                  grad16(P[static_cast<uint8_t>(BB + 1)], xx - N, yy - N, zz - N), u);
+
+    const int16_t Y1 = lerp15by16(X1, X2, v);
+    const int16_t Y2 = lerp15by16(X3, X4, v);
+    return lerp15by16(Y1, Y2, w);
+}
+
+inline uint16_t inoise16(uint32_t x, uint32_t y, uint32_t z) {
+    const int32_t ans = inoise16_raw(x, y, z) + 19052L;
+    const uint32_t pan = static_cast<uint32_t>(ans) * 440UL;
+    return static_cast<uint16_t>(pan >> 8);
+}
+
+// ===== Colors =====
+struct CHSV {
+    uint8_t h = 0, s = 0, v = 0;
+    CHSV() = default;
+    CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB {
+    union {
+        struct {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    enum HTMLColorCode : uint32_t {
+        Black = 0x000000,
+        White = 0xFFFFFF,
+        Red = 0xFF0000,
+        Green = 0x008000,
+        Blue = 0x0000FF,
+        Yellow = 0xFFFF00,
+        Orange = 0xFFA500,
+        Purple = 0x800080,
+        LightPink = 0xFFB6C1,
+        DeepPink = 0xFF1493,
+    };
+
+    constexpr CRGB() : r(0), g(0), b(0) {}
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    constexpr CRGB(uint32_t code) : r((code >> 16) & 0xFF), g((code >> 8) & 0xFF), b(code & 0xFF) {}
+    constexpr CRGB(HTMLColorCode code) : CRGB(static_cast<uint32_t>(code)) {}
+    CRGB(const CHSV &hsv);
+
+    uint8_t &operator[](uint8_t i) { return raw[i]; }
+    const uint8_t &operator[](uint8_t i) const { return raw[i]; }
+
+    CRGB &nscale8_video(uint8_t scale) {
+        r = scale8_video(r, scale);
+        g = scale8_video(g, scale);
+        b = scale8_video(b, scale);
+        return *this;
+    }
+
+    CRGB &nscale8(uint8_t scale) {
+        r = scale8(r, scale);
+        g = scale8(g, scale);
+        b = scale8(b, scale);
+        return *this;
+    }
+};
+
+inline bool operator==(const CRGB &a, const CRGB &b) { return a.r == b.r && a.g == b.g && a.b == b.b; }
+inline bool operator!=(const CRGB &a, const CRGB &b) { return !(a == b); }
+
+inline void fill_solid(CRGB *leds, int numToFill, const CRGB &color) {
+    for (int i = 0; i < numToFill; i++) leds[i] = color;
+}
+
+CHSV rgb2hsv_approximate(const CRGB &rgb);
+
+// ===== Controller =====
+class CFastLED {
+public:
+    typedef void (*ShowHook)(const CRGB *leds, int count);
+
+    void addLeds(CRGB *leds, int count) { leds_ = leds; count_ = count; }
+
+    void setBrightness(uint8_t scale) { brightness_ = scale; }
+    uint8_t getBrightness() const { return brightness_; }
+    void setDither(uint8_t) {}
+    void setMaxPowerInVoltsAndMilliamps(uint8_t, uint32_t) {}
+
+    void setShowHook(ShowHook hook) { hook_ = hook; }
+    void show() { if (hook_ && leds_) hook_(leds_, count_); }
+
+private:
+    CRGB *leds_ = nullptr;
+    int count_ = 0;
+    uint8_t brightness_ = 255;
+    ShowHook hook_ = nullptr;
+};
+
+extern CFastLED FastLED;
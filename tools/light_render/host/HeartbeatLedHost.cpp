@@ -0,0 +1,60 @@
+/**
+ * @file HeartbeatLedHost.cpp
+ * @brief Host stand-in for HeartbeatLed implementation
+ * @version 261016X
+ * @date 2026-10-16
+ *
+ * Same loop as the LEDC task in lib/LightController/HeartbeatLed.cpp, with
+ * each hardware fade recorded instead of run.
+ */
+#include "HeartbeatLed.h"
+#include "HeartbeatLedHost.h"
+
+namespace {
+
+HeartbeatLed::WaveSource waveSource = nullptr;
+uint32_t atMs = 0;
+uint8_t phase = 0;    // 0 rise, 1 fall, 2 dark
+uint8_t peak = 0;     // Top of the current breath
+uint16_t darkMs = 0;  // Dark after the current fall
+
+} // namespace
+
+namespace HeartbeatLed {
+
+bool begin(WaveSource source) {
+    if (waveSource) return true;
+    if (!source) return false;
+    waveSource = source;
+    return true;
+}
+
+} // namespace HeartbeatLed
+
+std::vector<HostFade> hostHeartbeatPlay(uint32_t ms) {
+    std::vector<HostFade> out;
+    if (!waveSource) return out;
+    const uint32_t endMs = atMs + ms;
+    while (atMs < endMs) {
+        HostFade f{atMs, 0, 0, 0};
+        if (phase == 0) {
+            const HeartbeatWave rise = waveSource();
+            peak = rise.peak;
+            f.to = peak;
+            f.ms = rise.riseMs;
+            phase = 1;
+        } else if (phase == 1) {
+            const HeartbeatWave fall = waveSource();
+            f.from = peak;
+            f.ms = fall.fallMs;
+            darkMs = fall.darkMs;
+            phase = darkMs ? 2 : 0;
+        } else {
+            f.ms = darkMs;
+            phase = 0;
+        }
+        out.push_back(f);
+        atMs += f.ms;
+    }
+    return out;
+}
@@ -0,0 +1,21 @@
+/**
+ * @file HeartbeatLedHost.h
+ * @brief Host stand-in for HeartbeatLed: plays the LED task's fades on a virtual clock
+ * @version 261016X
+ * @date 2026-10-16
+ */
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// One step of the LED task: a fade from -> to, or a dark hold (from == to == 0)
+struct HostFade {
+    uint32_t atMs;
+    uint8_t from, to;
+    uint16_t ms;
+};
+
+// Run the LED task loop for ms of virtual time from where the last call stopped,
+// asking the wave source at every fade like the device. Empty before begin().
+std::vector<HostFade> hostHeartbeatPlay(uint32_t ms);
@@ -0,0 +1,29 @@
+/**
+ * @file HostFirmware.cpp
+ * @brief Fixed answers for firmware functions outside the compiled set (light_render, host tests)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * SD status, audio level and hardware fail bits, as the light sources ask for
+ * them. The run simulation (tools/host_tests/sim) links the real AlertState,
+ * AudioState and StatusFlags instead and leaves this file out.
+ */
+#include <Arduino.h>
+
+#include "AudioState.h"
+#include "Alert/AlertState.h"
+#include "StatusFlags.h"
+
+namespace AlertState {
+bool isSdOk() { return true; }
+} // namespace AlertState
+
+bool hostAudioBusy = false;  // test_baked_show plays "audio" next to the show
+bool isAudioBusy() { return hostAudioBusy; }
+int16_t getAudioLevelRaw() { return 0; }
+AudioBands getAudioBands() { return {}; }
+
+uint64_t hostHardwareFailBits = 0;  // test_heartbeat plays the failure pattern
+namespace StatusFlags {
+uint64_t getHardwareFailBits() { return hostHardwareFailBits; }
+} // namespace StatusFlags
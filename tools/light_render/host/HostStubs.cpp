@@ -0,0 +1,170 @@
+/**
+ * @file HostStubs.cpp
+ * @brief Host implementations behind the stand-in headers (light_render, host tests)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Clock, random, Serial, FastLED controller and SD file access. The few
+ * firmware functions the light sources call outside the compiled set live in
+ * HostFirmware.cpp.
+ */
+#include <Arduino.h>
+#include <FastLED.h>
+#include <SD.h>
+#include <chrono>
+#include <random>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "SDController.h"
+
+HostSerial Serial;
+CFastLED FastLED;
+SDFS SD;
+
+// ===== Time =====
+static const auto hostStart = std::chrono::steady_clock::now();
+
+uint32_t millis() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - hostStart).count());
+}
+
+uint32_t micros() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - hostStart).count());
+}
+
+// ===== Random (fixed seed: repeatable renders) =====
+static std::mt19937 hostRng(27);
+
+long random(long howbig) {
+    return howbig > 0 ? static_cast<long>(hostRng() % static_cast<unsigned long>(howbig)) : 0;
+}
+
+long random(long howsmall, long howbig) {
+    return howbig > howsmall ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+    hostRng.seed(static_cast<uint32_t>(seed));
+}
+
+// ===== Files =====
+namespace fs {
+
+size_t File::size() const {
+    if (!fp_) return 0;
+    struct stat st;
+    return fstat(fileno(fp_), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+int File::available() {
+    if (!fp_) return 0;
+    const long pos = ftell(fp_);
+    return pos < 0 ? 0 : static_cast<int>(size() - static_cast<size_t>(pos));
+}
+
+int File::read() {
+    return fp_ ? fgetc(fp_) : -1;
+}
+
+String File::readStringUntil(char terminator) {
+    String out;
+    for (int c = read(); c >= 0 && c != terminator; c = read()) {
+        out += static_cast<char>(c);
+    }
+    return out;
+}
+
+void File::close() {
+    if (fp_) fclose(fp_);
+    fp_ = nullptr;
+    dir_ = false;
+}
+
+} // namespace fs
+
+String SDFS::hostPath(const char *path) const {
+    String full = root_;
+    if (!path || path[0] != '/') full += '/';
+    full += path ? path : "";
+    return full;
+}
+
+File SDFS::open(const char *path, const char *mode) {
+    const String full = hostPath(path);
+    struct stat st;
+    if (stat(full.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        return File(nullptr, String(path), true);
+    }
+    FILE *fp = fopen(full.c_str(), mode[0] == 'r' ? "rb" : mode[0] == 'a' ? "ab" : "wb");
+    return fp ? File(fp, String(path)) : File();
+}
+
+bool SDFS::exists(const char *path) const {
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool SDFS::remove(const char *path) {
+    return ::remove(hostPath(path).c_str()) == 0;
+}
+
+bool SDFS::mkdir(const char *path) {
+    return ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
+
+bool SDFS::rmdir(const char *path) {
+    return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+bool SDController::writeTextFile(const char *path, const char *text) {
+    File f = SD.open(path, FILE_WRITE);
+    if (!f) return false;
+    f.print(text);
+    f.close();
+    return true;
+}
+
+String SDController::readTextFile(const char *path) {
+    File f = SD.open(path, FILE_READ);
+    String out;
+    for (int c = f.read(); c >= 0; c = f.read()) {
+        out += static_cast<char>(c);
+    }
+    f.close();
+    return out;
+}
+
+// ===== HSV (spectrum approximation) =====
+CRGB::CRGB(const CHSV &hsv) {
+    const uint8_t region = hsv.h / 43;
+    const uint8_t rem = static_cast<uint8_t>((hsv.h - region * 43) * 6);
+    const uint8_t p = scale8(hsv.v, 255 - hsv.s);
+    const uint8_t q = scale8(hsv.v, 255 - scale8(hsv.s, rem));
+    const uint8_t t = scale8(hsv.v, 255 - scale8(hsv.s, 255 - rem));
+    switch (region) {
+        case 0:  r = hsv.v; g = t; b = p; break;
+        case 1:  r = q; g = hsv.v; b = p; break;
+        case 2:  r = p; g = hsv.v; b = t; break;
+        case 3:  r = p; g = q; b = hsv.v; break;
+        case 4:  r = t; g = p; b = hsv.v; break;
+        default: r = hsv.v; g = p; b = q; break;
+    }
+}
+
+CHSV rgb2hsv_approximate(const CRGB &rgb) {
+    const uint8_t hi = max(max(rgb.r, rgb.g), rgb.b);
+    const uint8_t lo = min(min(rgb.r, rgb.g), rgb.b);
+    CHSV hsv(0, 0, hi);
+    if (hi == 0 || hi == lo) return hsv;
+    const int delta = hi - lo;
+    hsv.s = static_cast<uint8_t>(255 * delta / hi);
+    int h;
+    if (hi == rgb.r)      h = 43 * (rgb.g - rgb.b) / delta;
+    else if (hi == rgb.g) h = 85 + 43 * (rgb.b - rgb.r) / delta;
+    else                  h = 171 + 43 * (rgb.r - rgb.g) / delta;
+    hsv.h = static_cast<uint8_t>(h);
+    return hsv;
+}
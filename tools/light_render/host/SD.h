@@ -0,0 +1,28 @@
+/**
+ * @file SD.h
+ * @brief Host stand-in for the ESP32 SD library (light_render tool)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * SD paths ("/light_patterns.csv") map to files below a host directory.
+ */
+#pragma once
+
+#include "FS.h"
+
+class SDFS : public fs::FS {
+public:
+    void setRoot(const char *dir) { root_ = dir ? dir : "."; }
+    String hostPath(const char *path) const;
+
+    File open(const char *path, const char *mode = FILE_READ) override;
+    bool exists(const char *path) const override;
+    bool remove(const char *path) override;
+    bool mkdir(const char *path) override;
+    bool rmdir(const char *path) override;
+
+private:
+    String root_ = ".";
+};
+
+extern SDFS SD;
@@ -0,0 +1,54 @@
+/**
+ * @file SDController.h
+ * @brief Host stand-in for SDController (light_render tool)
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Same static file API as lib/SDController, without card handling. The
+ * audio index reads are declared for the run simulation, which defines them
+ * (tools/host_tests/sim). Locking is a no-op: the tools are single-threaded.
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <SD.h>
+#include "Globals.h"
+#include "SDSettings.h"
+
+struct DirEntry {
+    uint16_t fileCount;
+    uint16_t totalScore;
+};
+
+struct FileEntry {
+    uint16_t sizeKb;
+    uint8_t  score;     // 1..200, 0=empty
+    uint8_t  reserved;
+};
+
+class SDController {
+public:
+    SDController() = delete;
+
+    static void lockSD() {}
+    static void unlockSD() {}
+
+    static bool readDirEntry(uint8_t dir_num, DirEntry *entry);
+    static bool readFileEntry(uint8_t dir_num, uint8_t file_num, FileEntry *entry);
+    static uint8_t getHighestDirNum();
+
+    static bool   fileExists(const char *fullPath) { return SD.exists(fullPath); }
+    static bool   writeTextFile(const char *path, const char *text);
+    static String readTextFile(const char *path);
+    static bool   deleteFile(const char *path) { return SD.remove(path); }
+
+    static File openFileRead(const char *path) { return SD.open(path, FILE_READ); }
+    static File openFileWrite(const char *path) { return SD.open(path, FILE_WRITE); }
+    static void closeFile(File &file) { file.close(); }
+
+    static File openStream(const char *path) { return SD.open(path, FILE_READ); }
+    static size_t readStream(File &file, uint32_t pos, uint8_t *buf, size_t len) {
+        return file && (file.position() == pos || file.seek(pos)) ? file.read(buf, len) : 0;
+    }
+    static void closeStream(File &file) { file.close(); }
+};
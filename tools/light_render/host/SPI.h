@@ -0,0 +1,9 @@
+/**
+ * @file SPI.h
+ * @brief Host stand-in for the ESP32 SPI header (light_render tool)
+ * @version 261016O
+ * @date 2026-10-16
+ */
+#pragma once
+
+class SPIClass {};
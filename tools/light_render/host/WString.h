@@ -0,0 +1,125 @@
+/**
+ * @file WString.h
+ * @brief Host stand-in for the Arduino String class (light_render tool)
+ * @version 261016O
+ * @date 2026-10-16
+ *
+ * std::string underneath; only the members the compiled firmware sources use.
+ * Numeric concatenation follows Arduino: += of a char appends the character,
+ * += of any other integer or float appends its decimal text.
+ */
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <strings.h>
+
+class String {
+public:
+    String() = default;
+    String(const char *s) : s_(s ? s : "") {}
+    String(const std::string &s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(unsigned char v) : s_(std::to_string(v)) {}
+    explicit String(int v) : s_(std::to_string(v)) {}
+    explicit String(unsigned int v) : s_(std::to_string(v)) {}
+    explicit String(long v) : s_(std::to_string(v)) {}
+    explicit String(unsigned long v) : s_(std::to_string(v)) {}
+    explicit String(float v, unsigned int decimals = 2) : s_(fixed(v, decimals)) {}
+    explicit String(double v, unsigned int decimals = 2) : s_(fixed(v, decimals)) {}
+
+    const char *c_str() const { return s_.c_str(); }
+    unsigned int length() const { return static_cast<unsigned int>(s_.size()); }
+    bool isEmpty() const { return s_.empty(); }
+    bool reserve(unsigned int size) { s_.reserve(size); return true; }
+    void clear() { s_.clear(); }
+
+    char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : '\0'; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    char &operator[](unsigned int i) { return s_[i]; }
+
+    bool concat(const String &v) { s_ += v.s_; return true; }
+    bool concat(const char *v) { if (v) s_ += v; return true; }
+    bool concat(const char *v, unsigned int n) { if (v) s_.append(v, n); return true; }
+    bool concat(char c) { s_ += c; return true; }
+    bool concat(unsigned char v) { s_ += std::to_string(v); return true; }
+    bool concat(int v) { s_ += std::to_string(v); return true; }
+    bool concat(unsigned int v) { s_ += std::to_string(v); return true; }
+    bool concat(long v) { s_ += std::to_string(v); return true; }
+    bool concat(unsigned long v) { s_ += std::to_string(v); return true; }
+    bool concat(float v) { s_ += fixed(v, 2); return true; }
+    bool concat(double v) { s_ += fixed(v, 2); return true; }
+
+    template <typename T>
+    String &operator+=(const T &v) { concat(v); return *this; }
+
+    int indexOf(char c, unsigned int from = 0) const { return pos(s_.find(c, from)); }
+    int indexOf(const String &v, unsigned int from = 0) const { return pos(s_.find(v.s_, from)); }
+    int lastIndexOf(char c) const { return pos(s_.rfind(c)); }
+    int lastIndexOf(const String &v) const { return pos(s_.rfind(v.s_)); }
+
+    String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= s_.size()) return String();
+        return String(s_.substr(from, to - from));
+    }
+
+    bool startsWith(const String &v) const { return s_.compare(0, v.s_.size(), v.s_) == 0; }
+    bool endsWith(const String &v) const {
+        return s_.size() >= v.s_.size() && s_.compare(s_.size() - v.s_.size(), v.s_.size(), v.s_) == 0;
+    }
+    bool equals(const String &v) const { return s_ == v.s_; }
+    bool equalsIgnoreCase(const String &v) const { return strcasecmp(s_.c_str(), v.s_.c_str()) == 0; }
+
+    void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s_.size()) s_.erase(index, count); }
+    void trim() {
+        const size_t b = s_.find_first_not_of(" \t\r\n\v\f");
+        if (b == std::string::npos) { s_.clear(); return; }
+        s_ = s_.substr(b, s_.find_last_not_of(" \t\r\n\v\f") - b + 1);
+    }
+    void toLowerCase() { for (char &c : s_) c = static_cast<char>(tolower(static_cast<unsigned char>(c))); }
+    void toUpperCase() { for (char &c : s_) c = static_cast<char>(toupper(static_cast<unsigned char>(c))); }
+    void replace(const String &find, const String &with) {
+        if (find.s_.empty()) return;
+        for (size_t p = s_.find(find.s_); p != std::string::npos; p = s_.find(find.s_, p + with.s_.size())) {
+            s_.replace(p, find.s_.size(), with.s_);
+        }
+    }
+
+    long toInt() const { return atol(s_.c_str()); }
+    float toFloat() const { return static_cast<float>(atof(s_.c_str())); }
+    double toDouble() const { return atof(s_.c_str()); }
+
+    bool operator==(const String &v) const { return s_ == v.s_; }
+    bool operator==(const char *v) const { return s_ == (v ? v : ""); }
+    bool operator!=(const String &v) const { return s_ != v.s_; }
+    bool operator!=(const char *v) const { return !(*this == v); }
+    bool operator<(const String &v) const { return s_ < v.s_; }
+
+private:
+    static int pos(size_t p) { return p == std::string::npos ? -1 : static_cast<int>(p); }
+    static std::string fixed(double v, unsigned int decimals) {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", static_cast<int>(decimals), v);
+        return buf;
+    }
+
+    std::string s_;
+};
+
+// Result type of String operator+ on Arduino; ArduinoJson adapts both
+class StringSumHelper : public String {
+public:
+    using String::String;
+    StringSumHelper(const String &s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String &a, const String &b) { StringSumHelper r(a); r += b; return r; }
+inline StringSumHelper operator+(const String &a, const char *b) { StringSumHelper r(a); r += b; return r; }
+inline StringSumHelper operator+(const char *a, const String &b) { StringSumHelper r(a); r += b; return r; }
+inline StringSumHelper operator+(const String &a, char b) { StringSumHelper r(a); r += b; return r; }
+inline bool operator==(const char *a, const String &b) { return b == a; }
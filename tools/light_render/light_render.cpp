@@ -0,0 +1,420 @@
+/**
+ * @file light_render.cpp
+ * @brief Offline light show renderer: patterns and colors to PNG/GIF on the host
+ * @version 261016Z
+ * @date 2026-10-16
+ *
+ * Links the firmware's LightController, LightCompositor, LEDMap, TimerManager
+ * and the pattern/color catalogs unmodified against the stand-ins in host/.
+ * The repaint timer runs on a virtual clock exactly like LightBoot sets it up,
+ * so N seconds of show render in well under a second, frame-rate governor,
+ * dirty tracking and dithering included. Each repaint tick prints its render
+ * cost; the captured output is written as a time x LED strip (PNG), one PNG
+ * per frame, and/or an animated GIF of the dome seen from above (LED map).
+ * --morph-to switches to a second pattern/color mid-render and reports the
+ * render cost and the largest LED step while the transition runs.
+ * Zones from light_zones.csv render as on the device.
+ *
+ * Build: tools/light_render/build.sh   Usage: light_render --help
+ */
+#include <Arduino.h>
+#include <FastLED.h>
+#include <SD.h>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "Globals.h"
+#include "LightController.h"
+#include "LEDMap.h"
+#include "TimerManager.h"
+#include "PatternCatalog.h"
+#include "ColorsCatalog.h"
+#include "BakedShow.h"
+#include "LightZones.h"
+#include "ZoneTable.h"
+#include "ImageWriter.h"
+
+namespace {
+
+struct Options {
+    const char *sdRoot = "sdroot";
+    const char *ledMap = "/ledmap.bin";
+    const char *patternId = nullptr;
+    const char *colorId = nullptr;
+    int program = -1;                      // -1 = the pattern's own program column
+    float seconds = 10.0f;
+    uint16_t fps = 0;                      // 0 = follow the governor
+    int brightness = -1;                   // -1 = Globals::brightnessHi
+    const char *stripPath = nullptr;
+    const char *gifPath = nullptr;
+    const char *framePrefix = nullptr;
+    int size = 320;
+    bool list = false;
+    bool quiet = false;
+    const char *morphPattern = nullptr;    // --morph-to: switch to this pattern/color at morphAt
+    const char *morphColor = nullptr;
+    float morphAt = -1.0f;                 // -1 = a third into the render
+    int morphMs = -1;                      // -1 = Globals::lightMorphMs
+    int baked = -1;                        // -1 = the pattern's own baked column
+};
+
+struct Frame {
+    uint32_t atMs;
+    bool shown;
+    uint32_t renderUs;
+    bool morphing;         // A pattern/color change was morphing in this tick
+    CRGB leds[NUM_LEDS];
+};
+
+// ===== Simulation state =====
+uint32_t simMs = 0;
+std::vector<Frame> frames;       // Strip output at every repaint tick
+CRGB stripOut[NUM_LEDS];         // Last buffer handed to FastLED.show()
+bool shownThisTick = false;
+
+TimerHandle repaintTimer;
+uint16_t repaintMs = 50;
+uint16_t fixedFrameMs = 0;
+bool quiet = false;
+
+uint64_t renderUsTotal = 0;
+uint32_t renderUsWorst = 0;
+
+uint32_t simClock() {
+    return simMs;
+}
+
+void onShow(const CRGB *out, int count) {
+    memcpy(stripOut, out, sizeof(CRGB) * min(count, NUM_LEDS));
+    shownThisTick = true;
+}
+
+// Same as LightBoot's repaint callback, plus capture and cost report
+void cb_repaint() {
+    shownThisTick = false;
+    const auto start = std::chrono::steady_clock::now();
+    updateLightController();
+    const uint32_t us = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    renderUsTotal += us;
+    renderUsWorst = max(renderUsWorst, us);
+
+    Frame f;
+    f.atMs = simMs;
+    f.shown = shownThisTick;
+    f.renderUs = us;
+    f.morphing = isLightMorphing();
+    memcpy(f.leds, stripOut, sizeof(stripOut));
+    frames.push_back(f);
+
+    if (!quiet) {
+        printf("%u;%u;%u;%u;%d\n", static_cast<unsigned>(frames.size() - 1), simMs, repaintMs, us,
+               shownThisTick ? 1 : 0);
+    }
+
+    const uint16_t wantMs = fixedFrameMs ? fixedFrameMs : getFrameIntervalMs();
+    if (wantMs != repaintMs && timers.restart(repaintTimer, wantMs, 0)) {
+        repaintMs = wantMs;
+    }
+}
+
+// ===== Images =====
+void renderStrip(std::vector<uint8_t> &rgb) {
+    rgb.resize(frames.size() * NUM_LEDS * 3);
+    for (size_t y = 0; y < frames.size(); y++) {
+        memcpy(&rgb[y * NUM_LEDS * 3], frames[y].leds, NUM_LEDS * 3);
+    }
+}
+
+// Dome from above: each LED a disc at its LED map position
+class MapCanvas {
+public:
+    explicit MapCanvas(int size) : size_(size) {
+        const float *xs = getLEDMapX();
+        const float *ys = getLEDMapY();
+        float lo = xs[0], hi = xs[0];
+        for (int i = 0; i < NUM_LEDS; i++) {
+            lo = std::min({lo, xs[i], ys[i]});
+            hi = std::max({hi, xs[i], ys[i]});
+        }
+        radius_ = max(2, size / 40);
+        const float span = max(hi - lo, 1e-3f);
+        const float usable = static_cast<float>(size - 2 * radius_ - 2);
+        for (int i = 0; i < NUM_LEDS; i++) {
+            px_[i] = radius_ + 1 + static_cast<int>((xs[i] - lo) / span * usable);
+            py_[i] = size - 1 - (radius_ + 1 + static_cast<int>((ys[i] - lo) / span * usable));  // y up
+        }
+    }
+
+    void draw(const CRGB *leds, std::vector<uint8_t> &rgb) const {
+        rgb.assign(static_cast<size_t>(size_) * size_ * 3, 8);  // Near-black background: dark LEDs stay visible as gaps
+        for (int i = 0; i < NUM_LEDS; i++) {
+            for (int dy = -radius_; dy <= radius_; dy++) {
+                for (int dx = -radius_; dx <= radius_; dx++) {
+                    if (dx * dx + dy * dy > radius_ * radius_) continue;
+                    const int x = px_[i] + dx, y = py_[i] + dy;
+                    if (x < 0 || y < 0 || x >= size_ || y >= size_) continue;
+                    memcpy(&rgb[(static_cast<size_t>(y) * size_ + x) * 3], leds[i].raw, 3);
+                }
+            }
+        }
+    }
+
+private:
+    int size_;
+    int radius_;
+    int px_[NUM_LEDS];
+    int py_[NUM_LEDS];
+};
+
+// ===== Catalogs =====
+void listCatalogs() {
+    String error;
+    PatternCatalog &patterns = PatternCatalog::instance();
+    const String firstPattern = patterns.firstPatternId();
+    printf("patterns:\n");
+    if (!firstPattern.isEmpty() && patterns.select(firstPattern, error)) {
+        do {
+            printf("  %-12s %s\n", patterns.activeId().c_str(), patterns.getLabelForId(patterns.activeId()).c_str());
+        } while (patterns.selectNext(error) && patterns.activeId() != firstPattern);
+    }
+
+    ColorsCatalog &colors = ColorsCatalog::instance();
+    const String firstColor = colors.firstColorId();
+    printf("colors:\n");
+    if (!firstColor.isEmpty() && colors.selectColor(firstColor, error)) {
+        do {
+            printf("  %-12s %s\n", colors.getActiveColorId().c_str(),
+                   colors.getLabelForId(colors.getActiveColorId()).c_str());
+        } while (colors.selectNextColor(error) && colors.getActiveColorId() != firstColor);
+    }
+}
+
+bool loadShow(const Options &opt, LightShowParams &params) {
+    PatternCatalog &patterns = PatternCatalog::instance();
+    const String patternId = opt.patternId ? String(opt.patternId) : patterns.firstPatternId();
+    if (!patterns.getParamsForId(patternId, params)) {
+        fprintf(stderr, "pattern '%s' not found in %s/light_patterns.csv\n", patternId.c_str(), opt.sdRoot);
+        return false;
+    }
+
+    ColorsCatalog &colors = ColorsCatalog::instance();
+    const String colorId = opt.colorId ? String(opt.colorId) : colors.firstColorId();
+    String label;
+    if (!colors.getColorById(colorId, label, params.RGB1, params.RGB2)) {
+        fprintf(stderr, "color '%s' not found in %s/light_colors.csv\n", colorId.c_str(), opt.sdRoot);
+        return false;
+    }
+    fprintf(stderr, "pattern %s (%s), color %s (%s)\n", patternId.c_str(),
+            patterns.getLabelForId(patternId).c_str(), colorId.c_str(), label.c_str());
+    return true;
+}
+
+void usage() {
+    printf("Render a light pattern offline with the firmware's own LightController.\n\n"
+           "light_render [options]\n"
+           "  --sd DIR          SD root with light_patterns.csv, light_colors.csv (default sdroot)\n"
+           "  --ledmap PATH     LED map below the SD root (default /ledmap.bin; ring fallback if absent)\n"
+           "  --pattern ID      pattern id (default: first pattern)\n"
+           "  --color ID        color set id (default: first color set)\n"
+           "  --program N       render with light program N (/light_programs/N.lpb), 0 = ring renderer\n"
+           "  --seconds N       simulated show time (default 10)\n"
+           "  --fps N           repaint at a fixed rate instead of the frame-rate governor\n"
+           "  --brightness N    output brightness (default Globals::brightnessHi)\n"
+           "  --strip FILE      PNG strip: one row per repaint tick, one column per LED\n"
+           "  --gif FILE        animated GIF of the LED map\n"
+           "  --frames PREFIX   one PNG of the LED map per repaint tick (PREFIX0000.png, ...)\n"
+           "  --size N          LED map image size in pixels (default 320)\n"
+           "  --list            list pattern and color ids, then exit\n"
+           "  --quiet           summary only, no per-tick lines\n"
+           "  --morph-to ID     switch to pattern ID mid-render (morph transition); --morph-color ID,\n"
+           "                    --morph-at SEC (default: a third in), --morph-ms N (default lightMorphMs)\n"
+           "  --baked N         play baked show N (/light_shows/N.lsb), 0 = render live\n\n"
+           "Per tick (stdout): tick;time_ms;interval_ms;render_us;shown\n");
+}
+
+bool parseArgs(int argc, char **argv, Options &opt) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char *v = nullptr;
+        if (arg == "--list") opt.list = true;
+        else if (arg == "--quiet") opt.quiet = true;
+        else if (arg == "--help" || arg == "-h") return false;
+        else if (!(v = value())) return false;
+        else if (arg == "--sd") opt.sdRoot = v;
+        else if (arg == "--ledmap") opt.ledMap = v;
+        else if (arg == "--pattern") opt.patternId = v;
+        else if (arg == "--color") opt.colorId = v;
+        else if (arg == "--program") opt.program = atoi(v);
+        else if (arg == "--seconds") opt.seconds = static_cast<float>(atof(v));
+        else if (arg == "--fps") opt.fps = static_cast<uint16_t>(atoi(v));
+        else if (arg == "--brightness") opt.brightness = atoi(v);
+        else if (arg == "--strip") opt.stripPath = v;
+        else if (arg == "--gif") opt.gifPath = v;
+        else if (arg == "--frames") opt.framePrefix = v;
+        else if (arg == "--size") opt.size = max(32, atoi(v));
+        else if (arg == "--morph-to") opt.morphPattern = v;
+        else if (arg == "--morph-color") opt.morphColor = v;
+        else if (arg == "--morph-at") opt.morphAt = static_cast<float>(atof(v));
+        else if (arg == "--morph-ms") opt.morphMs = atoi(v);
+        else if (arg == "--baked") opt.baked = atoi(v);
+        else return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+    quiet = opt.quiet;
+
+    SD.setRoot(opt.sdRoot);
+    timers.setClock(simClock);
+    FastLED.addLeds(leds, NUM_LEDS);
+    FastLED.setShowHook(onShow);
+
+    PatternCatalog::instance().begin();
+    ColorsCatalog::instance().begin();
+    if (opt.list) {
+        listCatalogs();
+        return 0;
+    }
+    LightShowParams params;
+    if (!loadShow(opt, params)) return 1;
+    if (opt.program >= 0) params.program = static_cast<uint8_t>(opt.program);
+    if (opt.baked >= 0) params.baked = static_cast<uint8_t>(opt.baked);
+
+    const bool morph = opt.morphPattern || opt.morphColor;
+    LightShowParams morphParams;
+    if (morph) {
+        Options second = opt;
+        second.patternId = opt.morphPattern ? opt.morphPattern : opt.patternId;
+        second.colorId = opt.morphColor ? opt.morphColor : opt.colorId;
+        if (!loadShow(second, morphParams)) return 1;
+        if (opt.morphMs >= 0) Globals::lightMorphMs = static_cast<uint16_t>(opt.morphMs);
+    }
+
+    loadLEDMapFromSD(opt.ledMap);
+    ZoneTable::instance().begin();  // Like LightRun::plan: zones on top of the chosen show
+    if (ZoneTable::instance().zoneCount()) {
+        fprintf(stderr, "%u zones from light_zones.csv\n", static_cast<unsigned>(ZoneTable::instance().zoneCount()));
+    }
+
+    const uint8_t brightness = static_cast<uint8_t>(constrain(
+        opt.brightness < 0 ? static_cast<int>(Globals::brightnessHi) : opt.brightness, 0, 255));
+    setBrightnessBaseHi(brightness);
+    setBrightnessShiftedHi(brightness);
+
+    if (opt.fps) fixedFrameMs = static_cast<uint16_t>(max(1, 1000 / opt.fps));
+    repaintMs = fixedFrameMs ? fixedFrameMs : repaintMs;
+    repaintTimer = timers.create(repaintMs, 0, cb_repaint, 1.0f, 1, TimerPriority::REALTIME);
+    // The firmware starts a baked show in the repaint tick; started here, a refused file ends the run
+    if (params.baked && !BakedShow::start(params.baked)) {
+        fprintf(stderr, "baked show %u refused (see log)\n", params.baked);
+        return 1;
+    }
+    PlayLightShow(params);
+
+    // Virtual time: jump straight to the next deadline
+    const uint32_t endMs = static_cast<uint32_t>(opt.seconds * 1000.0f);
+    if (!quiet) printf("tick;time_ms;interval_ms;render_us;shown\n");
+    const uint32_t morphAtMs = static_cast<uint32_t>((opt.morphAt < 0.0f ? opt.seconds / 3.0f : opt.morphAt) * 1000.0f);
+    bool morphStarted = false;
+    while (simMs < endMs) {
+        if (morph && !morphStarted && simMs >= morphAtMs) {
+            PlayLightShow(morphParams);
+            morphStarted = true;
+        }
+        uint32_t stepMs = timers.nextDeadline(endMs - simMs);
+        if (morph && !morphStarted) stepMs = min(stepMs, morphAtMs - simMs);
+        simMs += max<uint32_t>(1, stepMs);
+        timers.update();
+    }
+
+    // ===== Output =====
+    std::vector<uint8_t> rgb;
+    if (opt.stripPath && !frames.empty()) {
+        renderStrip(rgb);
+        if (!writePng(opt.stripPath, NUM_LEDS, static_cast<int>(frames.size()), rgb.data())) {
+            fprintf(stderr, "cannot write %s\n", opt.stripPath);
+            return 1;
+        }
+    }
+
+    if (opt.gifPath || opt.framePrefix) {
+        const MapCanvas canvas(opt.size);
+        GifWriter gif;
+        if (opt.gifPath && !gif.open(opt.gifPath, opt.size, opt.size)) {
+            fprintf(stderr, "cannot write %s\n", opt.gifPath);
+            return 1;
+        }
+        uint32_t shownCs = 0;
+        for (size_t i = 0; i < frames.size(); i++) {
+            canvas.draw(frames[i].leds, rgb);
+            if (opt.gifPath) {
+                // GIF delays are in 1/100 s: carry the rounding so the total stays on time,
+                // and drop frames that would get no display time at all
+                const uint32_t untilMs = i + 1 < frames.size() ? frames[i + 1].atMs : endMs;
+                const uint32_t untilCs = untilMs / 10;
+                if (untilCs > shownCs) {
+                    gif.addFrame(rgb.data(), static_cast<uint16_t>(untilCs - shownCs));
+                    shownCs = untilCs;
+                }
+            }
+            if (opt.framePrefix) {
+                char path[512];
+                snprintf(path, sizeof(path), "%s%04u.png", opt.framePrefix, static_cast<unsigned>(i));
+                writePng(path, opt.size, opt.size, rgb.data());
+            }
+        }
+        gif.close();
+    }
+
+    const size_t ticks = frames.size();
+    fprintf(stderr, "%zu ticks in %.1f s (%.1f fps), %u shown, %u skipped, render avg %.0f us, max %u us\n",
+            ticks, endMs / 1000.0f, ticks * 1000.0f / max<uint32_t>(endMs, 1), getFramesShown(),
+            getFramesSkipped(), ticks ? static_cast<double>(renderUsTotal) / ticks : 0.0, renderUsWorst);
+
+    if (morph) {
+        // Render cost inside vs. outside the transition, and the largest change of one LED
+        // channel between consecutive ticks in each (a jump shows up as one big step)
+        uint64_t usIn = 0, usOut = 0;
+        uint32_t ticksIn = 0, ticksOut = 0, worstUsIn = 0, stepIn = 0, stepOut = 0;
+        for (size_t i = 0; i < frames.size(); i++) {
+            const Frame &f = frames[i];
+            uint32_t step = 0;
+            if (i > 0) {
+                for (int led = 0; led < NUM_LEDS; led++) {
+                    for (int c = 0; c < 3; c++) {
+                        step = max<uint32_t>(step, abs(f.leds[led].raw[c] - frames[i - 1].leds[led].raw[c]));
+                    }
+                }
+            }
+            if (f.morphing) {
+                usIn += f.renderUs;
+                ticksIn++;
+                worstUsIn = max(worstUsIn, f.renderUs);
+                stepIn = max(stepIn, step);
+            } else {
+                usOut += f.renderUs;
+                ticksOut++;
+                stepOut = max(stepOut, step);
+            }
+        }
+        fprintf(stderr, "morph at %.1f s over %u ms: %u ticks, render avg %.1f us, max %u us "
+                "(outside: %u ticks, avg %.1f us); largest LED step %u in the morph, %u outside\n",
+                morphAtMs / 1000.0f, Globals::lightMorphMs, ticksIn, ticksIn ? static_cast<double>(usIn) / ticksIn : 0.0,
+                worstUsIn, ticksOut, ticksOut ? static_cast<double>(usOut) / ticksOut : 0.0, stepIn, stepOut);
+    }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+"""Resolve callback addresses in /api/health/timers output to function names.
+
+The firmware reports timer callbacks by address (TIMER_PROFILE builds). The
+linker map written at build time (-Wl,-Map in platformio.ini) lists every
+function section with its address, so names are resolved on the host.
+
+Usage:
+    python tools/resolve_timer_symbols.py 192.168.2.189
+    python tools/resolve_timer_symbols.py timers.json --map .pio/build/esp32/firmware.map
+"""
+import argparse, json, re, shutil, subprocess, urllib.request
+
+SECTION = re.compile(r"^\s*\.(?:text|iram1|literal)\.(\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x[0-9a-fA-F]+)?")
+ADDRESS = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x[0-9a-fA-F]+\s")
+SYMBOL  = re.compile(r"^\s+0x([0-9a-fA-F]+)\s{2,}([A-Za-z_].*\S)\s*$")
+
+
+def load_map(path):
+    """Return {address: name} from a GNU ld map file."""
+    names = {}
+    pending = None
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            m = SECTION.match(line)
+            if m:
+                pending = None if m.group(2) else m.group(1)
+                if m.group(2):
+                    names.setdefault(int(m.group(2), 16), m.group(1))
+                continue
+            if pending:
+                m = ADDRESS.match(line)
+                if m:
+                    names.setdefault(int(m.group(1), 16), pending)
+                pending = None
+                continue
+            m = SYMBOL.match(line)
+            if m:
+                names[int(m.group(1), 16)] = m.group(2)  # Global symbol lines win over section names
+    return names
+
+
+def demangle(names):
+    tool = shutil.which("c++filt") or shutil.which("xtensa-esp32-elf-c++filt")
+    mangled = sorted({n for n in names if n.startswith("_Z")})
+    if not tool or not mangled:
+        return {n: n for n in names}
+    out = subprocess.run([tool], input="\n".join(mangled), capture_output=True, text=True).stdout.splitlines()
+    table = dict(zip(mangled, out))
+    return {n: table.get(n, n) for n in names}
+
+
+def load_json(source):
+    if re.match(r"^\d+\.\d+\.\d+\.\d+$", source):
+        source = f"http://{source}/api/health/timers"
+    if source.startswith("http"):
+        with urllib.request.urlopen(source, timeout=5) as r:
+            return json.load(r)
+    with open(source, encoding="utf-8") as f:
+        return json.load(f)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("source", help="device IP, URL or saved JSON file")
+    ap.add_argument("--map", default=".pio/build/esp32/firmware.map", help="linker map of the running firmware")
+    args = ap.parse_args()
+
+    data = load_json(args.source)
+    if not data.get("profiling"):
+        print("Firmware built without TIMER_PROFILE (build with -DTIMER_PROFILE=1)")
+        return
+
+    by_addr = load_map(args.map)
+    pretty = demangle(set(by_addr.values()))
+    rows = sorted(data["profiles"], key=lambda p: p["totalMs"], reverse=True)
+
+    print(f"{'callback':48} {'tok':>3} {'calls':>9} {'totalMs':>9} {'avgUs':>7} {'maxUs':>8} {'avgLate':>7} {'maxLate':>7}")
+    for p in rows:
+        addr = int(p["cb"], 16)
+        name = pretty.get(by_addr.get(addr, ""), p["cb"])
+        print(f"{name[:48]:48} {p['token']:>3} {p['calls']:>9} {p['totalMs']:>9} {p['avgUs']:>7} "
+              f"{p['maxUs']:>8} {p['avgLateMs']:>7} {p['maxLateMs']:>7}")
+
+
+if __name__ == "__main__":
+    main()